@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+# Measures the start time of a program that imports Srl with and without a
+# warm JIT object cache.
+#
+# Usage: jit_cache_bench.py [path to alusus executable] [run count]
+
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SAMPLE = os.path.join(SCRIPT_DIR, "jit_cache_hello.alusus")
+
+
+def run(alusus, cache_dir):
+    start = time.perf_counter()
+    subprocess.run([alusus, "--jit-cache", cache_dir, SAMPLE], check=True, stdout=subprocess.DEVNULL)
+    return time.perf_counter() - start
+
+
+def main():
+    alusus = sys.argv[1] if len(sys.argv) > 1 else "alusus"
+    count = int(sys.argv[2]) if len(sys.argv) > 2 else 5
+
+    cold = []
+    warm = []
+    for _ in range(count):
+        cache_dir = tempfile.mkdtemp(prefix="alusus-jit-cache-")
+        try:
+            cold.append(run(alusus, cache_dir))
+            warm.append(run(alusus, cache_dir))
+        finally:
+            shutil.rmtree(cache_dir)
+
+    print("cold start: {:.3f} s (median of {})".format(statistics.median(cold), count))
+    print("warm start: {:.3f} s (median of {})".format(statistics.median(warm), count))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# Measures the time of building an executable from a large synthetic program
+# using Build.Exe with different partition counts.
+#
+# The time of a run that doesn't build anything is subtracted from each result
+# so that the reported times and speedups only cover the object file generation
+# and linking.
+#
+# Usage: parallel_codegen_bench.py [path to alusus executable] [function count] [max partition count]
+
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+RUN_COUNT = 3
+
+
+def write_program(path, function_count, partition_count, generate=True):
+    with open(path, "w") as f:
+        f.write('import "Srl/Console";\nimport "Build";\nuse Srl;\n\n')
+        f.write("module Bench {\n")
+        for i in range(function_count):
+            f.write(
+                "    func f{0}(n: Int): Int {{\n"
+                "        def r: Int = {0};\n"
+                "        def i: Int;\n"
+                "        for i = 0, i < n, ++i {{ if i % 3 == 0 r += i * {0} else r -= i; }}\n"
+                "        return r;\n"
+                "    }}\n".format(i)
+            )
+        f.write("    func start {\n        def total: Int = 0;\n")
+        for i in range(function_count):
+            f.write("        total += f{0}({0} % 17);\n".format(i))
+        f.write('        Console.print("%d\\n", total);\n    }\n}\n\n')
+        f.write('def exe: Build.Exe(Bench~ast, "{0}");\n'.format(os.path.splitext(path)[0]))
+        f.write("exe.partitionCount = {0};\n".format(partition_count))
+        if generate:
+            f.write("exe.generate();\n")
+
+
+def run(alusus, path):
+    start = time.perf_counter()
+    subprocess.run([alusus, path], check=True, stdout=subprocess.DEVNULL)
+    return time.perf_counter() - start
+
+
+def main():
+    alusus = sys.argv[1] if len(sys.argv) > 1 else "alusus"
+    function_count = int(sys.argv[2]) if len(sys.argv) > 2 else 2000
+    max_partition_count = int(sys.argv[3]) if len(sys.argv) > 3 else os.cpu_count()
+
+    work_dir = tempfile.mkdtemp(prefix="alusus-parallel-codegen-")
+    try:
+        path = os.path.join(work_dir, "bench_base.alusus")
+        write_program(path, function_count, 1, generate=False)
+        base_time = statistics.median([run(alusus, path) for _ in range(RUN_COUNT)])
+        print("{} functions, {} CPUs, {:.3f} s without building".format(function_count, os.cpu_count(), base_time))
+
+        single_time = None
+        partition_count = 1
+        while partition_count <= max_partition_count:
+            path = os.path.join(work_dir, "bench_{}.alusus".format(partition_count))
+            write_program(path, function_count, partition_count)
+            times = [run(alusus, path) for _ in range(RUN_COUNT)]
+            build_time = max(statistics.median(times) - base_time, 0.001)
+            if single_time is None:
+                single_time = build_time
+            print("{:3d} partitions: {:.3f} s, {:.2f}x (median of {})".format(
+                partition_count, build_time, single_time / build_time, RUN_COUNT
+            ))
+            partition_count *= 2
+    finally:
+        shutil.rmtree(work_dir)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,687 @@
+/**
+ * @file Benchmarks/main.cpp
+ * Contains the throughput benchmarks' main program.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include <stdlib.h>
+// Alusus header files
+#include <core.h>
+
+// System headers
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+using Core::Basic::PhaseStats;
+using Core::Main::RootManager;
+
+namespace Benchmarks
+{
+
+typedef PhaseStats::Phase Phase;
+
+/// The results of a single run over a single source file.
+struct Measurement
+{
+  Bool succeeded;
+  LongWord bytes;
+  LongWord tokens;
+  LongWord astNodes;
+  LongWord noticeCount;
+  LongWord peakRssKb;
+  LongWord totalTime;
+  LongWord phaseTimes[PhaseStats::PHASE_COUNT];
+  LongWord castCount;
+  LongWord castTime;
+  LongWord chainCastTime;
+  LongWord streamIngestionTime;
+  LongWord bulkIngestionTime;
+};
+
+
+LongWord getElapsedTime(std::chrono::steady_clock::time_point startTime)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+
+LongWord countAstNodes(TiObject *obj)
+{
+  if (obj == 0) return 0;
+  LongWord count = obj->isDerivedFrom<Core::Data::Node>() ? 1 : 0;
+  auto container = ti_cast<Core::Basic::Containing<TiObject>>(obj);
+  if (container != 0) {
+    for (Int i = 0; i < container->getElementCount(); ++i) count += countAstNodes(container->getElement(i));
+  }
+  return count;
+}
+
+
+void collectAstObjects(TiObject *obj, std::vector<TiObject*> &objects)
+{
+  if (obj == 0) return;
+  objects.push_back(obj);
+  auto container = ti_cast<Core::Basic::Containing<TiObject>>(obj);
+  if (container != 0) {
+    for (Int i = 0; i < container->getElementCount(); ++i) collectAstObjects(container->getElement(i), objects);
+  }
+}
+
+
+/**
+ * Writes a synthetic program that stresses code generation dependencies.
+ *
+ * The program defines the given number of global variables and functions.
+ * Each function reads its own global and calls two other functions, and a
+ * single entry function calls all of them, so the function and global
+ * variable dependency lists of the code generator grow to the size of the
+ * program.
+ */
+Bool writeDependencySample(Char const *path, Int count)
+{
+  std::ofstream fout(path);
+  if (fout.fail()) return false;
+  for (Int i = 0; i < count; ++i) {
+    fout << "def g" << i << ": Int = " << i << ";\n";
+  }
+  for (Int i = 0; i < count; ++i) {
+    fout << "func f" << i << "(n: Int): Int {\n"
+      << "  if n <= 0 return g" << i << ";\n"
+      << "  return f" << (i + 1) % count << "(n - 1) + f" << (i * 7 + 3) % count << "(n - 2);\n"
+      << "}\n";
+  }
+  fout << "func run {\n  def total: Int = 0;\n";
+  for (Int i = 0; i < count; ++i) fout << "  total += f" << i << "(1);\n";
+  fout << "}\nrun();\n";
+  return !fout.fail();
+}
+
+
+/// The derivation check as it was done before type infos had ancestor displays.
+Bool isDerivedFromByChain(TiObject const *obj, Core::Basic::TypeInfo const *info)
+{
+  Core::Basic::TypeInfo const *i = obj->getMyTypeInfo();
+  while (i != 0) {
+    if (i == info) return true;
+    i = i->getBaseTypeInfo();
+  }
+  return false;
+}
+
+
+/**
+ * Replays the casts of a codegen pass over the AST of the processed file.
+ *
+ * Every object in the tree is checked against every type that appears in
+ * the tree along with all of their base types, which mirrors the way the
+ * seeker and the generators probe each node against the types they handle.
+ * The checks are done once using the ancestor display and once by walking
+ * the base type chain, and the time of each is recorded.
+ */
+void measureCasts(TiObject *root, Measurement &m)
+{
+  std::vector<TiObject*> objects;
+  collectAstObjects(root, objects);
+  std::set<Core::Basic::TypeInfo const*> typeSet;
+  for (auto obj : objects) {
+    for (Core::Basic::TypeInfo const *i = obj->getMyTypeInfo(); i != 0; i = i->getBaseTypeInfo()) typeSet.insert(i);
+  }
+  std::vector<Core::Basic::TypeInfo const*> types(typeSet.begin(), typeSet.end());
+  m.castCount = objects.size() * types.size();
+
+  LongWord matches = 0;
+  auto startTime = std::chrono::steady_clock::now();
+  for (auto obj : objects) {
+    for (auto type : types) if (obj->isDerivedFrom(type)) ++matches;
+  }
+  m.castTime = getElapsedTime(startTime);
+
+  LongWord chainMatches = 0;
+  startTime = std::chrono::steady_clock::now();
+  for (auto obj : objects) {
+    for (auto type : types) if (isDerivedFromByChain(obj, type)) ++chainMatches;
+  }
+  m.chainCastTime = getElapsedTime(startTime);
+
+  if (matches != chainMatches) {
+    std::cerr << "Cast mismatch: " << matches << " matches using the display vs " << chainMatches
+      << " walking the chain.\n";
+    m.succeeded = false;
+  }
+}
+
+
+/**
+ * Lexes the given file on its own and returns the time it took.
+ *
+ * The file is either memory mapped and fed to the lexer in bulk, as done by
+ * Engine::processFile, or read through a stream and fed to the lexer one
+ * byte at a time, as done by Engine::processStream.
+ */
+LongWord measureIngestion(Char const *path, RootManager &root, Bool lexerDfa, Bool bulk)
+{
+  Core::Processing::Lexer lexer;
+  lexer.setDfaEnabled(lexerDfa);
+  lexer.initialize(root.getRootScope());
+  Core::Data::SourceLocationRecord sourceLocation;
+  sourceLocation.filename = path;
+  sourceLocation.line = 1;
+  sourceLocation.column = 1;
+  auto startTime = std::chrono::steady_clock::now();
+  if (bulk) {
+    Core::Processing::MappedFile mappedFile;
+    if (!mappedFile.open(path)) return 0;
+    lexer.handleNewString(mappedFile.getData(), mappedFile.getSize(), sourceLocation);
+  } else {
+    std::ifstream fin(path);
+    Core::Processing::StdCharInStream finStream(&fin);
+    Char c = finStream.get();
+    while (!finStream.isEof()) {
+      lexer.handleNewChar(c, sourceLocation);
+      c = finStream.get();
+    }
+  }
+  lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
+  return getElapsedTime(startTime);
+}
+
+
+/**
+ * Measures the processing of the given source file.
+ *
+ * Lexing is measured on its own by feeding the file to a standalone lexer
+ * that uses the same grammar. The file is then processed normally, during
+ * which Spp records the time spent in IR generation, optimization, and JIT
+ * linking. Whatever remains of the processing time is recorded as parsing,
+ * which includes AST construction since the parsing handlers build the AST
+ * while the grammar is being matched.
+ */
+Measurement measureFile(Char const *path, Bool lexerDfa, Bool casts, Bool ingestion)
+{
+  Measurement m;
+  memset(&m, 0, sizeof(m));
+
+  std::ifstream fin(path, std::ios::binary);
+  if (fin.fail()) return m;
+  std::string source((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+  m.bytes = source.size();
+
+  PHASE_STATS->reset();
+  RootManager root;
+  root.setLexerDfaEnabled(lexerDfa);
+  Slot<void, SharedPtr<Core::Notices::Notice> const&> noticeSlot(
+    [&m](SharedPtr<Core::Notices::Notice> const &notice)->void
+    {
+      ++m.noticeCount;
+    }
+  );
+  root.noticeSignal.connect(noticeSlot);
+
+  // Lex the file on its own.
+  {
+    Core::Processing::Lexer lexer;
+    lexer.setDfaEnabled(lexerDfa);
+    lexer.initialize(root.getRootScope());
+    Slot<void, Core::Data::Token const*> tokenSlot(
+      [&m](Core::Data::Token const *token)->void
+      {
+        ++m.tokens;
+      }
+    );
+    lexer.tokenGenerated.connect(tokenSlot);
+    Core::Data::SourceLocationRecord sourceLocation;
+    sourceLocation.filename = path;
+    sourceLocation.line = 1;
+    sourceLocation.column = 1;
+    PhaseStats::Timer timer(Phase::LEXING);
+    lexer.handleNewString(source.c_str(), sourceLocation);
+    lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
+  }
+  m.noticeCount = 0;
+
+  if (ingestion) {
+    m.streamIngestionTime = measureIngestion(path, root, lexerDfa, false);
+    m.bulkIngestionTime = measureIngestion(path, root, lexerDfa, true);
+  }
+
+  // Process the file normally.
+  LongWord nodesBefore = countAstNodes(root.getRootScope().get());
+  auto startTime = std::chrono::steady_clock::now();
+  try {
+    root.processFile(path);
+    m.succeeded = true;
+  } catch (Srl::Exception &e) {
+    std::cerr << "Failed to process " << path << ":\n" << e.getVerboseErrorMessage() << std::endl;
+  }
+  m.totalTime = getElapsedTime(startTime);
+  m.astNodes = countAstNodes(root.getRootScope().get()) - nodesBefore;
+  if (m.succeeded && casts) measureCasts(root.getRootScope().get(), m);
+
+  LongWord otherTime = PHASE_STATS->getTime(Phase::LEXING);
+  for (auto phase : { Phase::IR_GENERATION, Phase::OPTIMIZATION, Phase::JIT_LINKING }) {
+    otherTime += PHASE_STATS->getTime(phase);
+  }
+  PHASE_STATS->add(Phase::PARSING, m.totalTime > otherTime ? m.totalTime - otherTime : 0);
+
+  for (Int i = 0; i < PhaseStats::PHASE_COUNT; ++i) {
+    m.phaseTimes[i] = PHASE_STATS->getTime(Phase(static_cast<Phase::_Phase>(i)));
+  }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  #if defined(__APPLE__)
+    m.peakRssKb = usage.ru_maxrss / 1024;
+  #else
+    m.peakRssKb = usage.ru_maxrss;
+  #endif
+
+  return m;
+}
+
+
+/// Runs measureFile in a child process so that each run starts fresh and gets its own peak RSS.
+Measurement measureFileInChild(Char const *path, Bool lexerDfa, Bool casts, Bool ingestion)
+{
+  Measurement m;
+  memset(&m, 0, sizeof(m));
+
+  int fds[2];
+  if (pipe(fds) != 0) return m;
+  // Flush pending output so that it doesn't get written again by the child.
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    // Silence the output of the processed program.
+    freopen("/dev/null", "w", stdout);
+    m = measureFile(path, lexerDfa, casts, ingestion);
+    write(fds[1], &m, sizeof(m));
+    close(fds[1]);
+    _exit(EXIT_SUCCESS);
+  }
+  close(fds[1]);
+  if (pid > 0) {
+    if (read(fds[0], &m, sizeof(m)) != sizeof(m)) m.succeeded = false;
+    waitpid(pid, 0, 0);
+  }
+  close(fds[0]);
+  return m;
+}
+
+
+LongWord getMedian(std::vector<LongWord> values)
+{
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+
+Double getRate(LongWord count, LongWord microseconds)
+{
+  if (microseconds == 0) return 0;
+  return count * 1000000.0 / microseconds;
+}
+
+
+/**
+ * Measures building the two core grammars RootManager needs at startup by
+ * running the grammar factory into fresh scopes.
+ */
+LongWord benchmarkStartup(Int runCount)
+{
+  RootManager root;
+  std::vector<LongWord> times;
+  for (Int i = 0; i < runCount; ++i) {
+    auto scope = Core::Data::Ast::Scope::create();
+    auto exprScope = Core::Data::Ast::Scope::create();
+    auto startTime = std::chrono::steady_clock::now();
+    Core::Data::Grammar::StandardFactory factory;
+    factory.createGrammar(scope.get(), &root, false);
+    factory.createGrammar(exprScope.get(), &root, true);
+    times.push_back(getElapsedTime(startTime));
+  }
+  return getMedian(times);
+}
+
+
+/// The results of timing definition lookups in a large scope.
+struct ScopeResult
+{
+  Int definitionCount;
+  LongWord appendTime;
+  LongWord indexedLookupTime;
+  LongWord scanLookupTime;
+  LongWord middleInsertTime;
+};
+
+
+/**
+ * Measures the definitions index of Scope on a scope holding the given number
+ * of definitions.
+ *
+ * Each run appends the definitions to a fresh scope, then looks up every
+ * name once using the index and once by scanning the elements as was done
+ * before the index existed. Finally, a tenth as many definitions are
+ * inserted in the middle of the scope, which is the case that pays for
+ * shifting the index.
+ */
+ScopeResult benchmarkScope(Int count, Int runCount)
+{
+  ScopeResult result;
+  result.definitionCount = count;
+  std::vector<LongWord> appendTimes, indexedTimes, scanTimes, insertTimes;
+  for (Int run = 0; run < runCount; ++run) {
+    std::vector<SharedPtr<Core::Data::Ast::Definition>> defs;
+    for (Int i = 0; i < count; ++i) {
+      defs.push_back(Core::Data::Ast::Definition::create({ { "name", TiStr(("d" + std::to_string(i)).c_str()) } }));
+    }
+    auto scope = Core::Data::Ast::Scope::create();
+
+    auto startTime = std::chrono::steady_clock::now();
+    for (auto const &def : defs) scope->add(def);
+    appendTimes.push_back(getElapsedTime(startTime));
+
+    LongWord found = 0;
+    startTime = std::chrono::steady_clock::now();
+    for (auto const &def : defs) {
+      if (scope->findDefinitionIndex(def->getName().getStr()) != -1) ++found;
+    }
+    indexedTimes.push_back(getElapsedTime(startTime));
+
+    LongWord scanFound = 0;
+    startTime = std::chrono::steady_clock::now();
+    for (auto const &def : defs) {
+      for (Int i = 0; i < scope->getCount(); ++i) {
+        auto element = ti_cast<Core::Data::Ast::Definition>(scope->getElement(i));
+        if (element != 0 && element->getName().getStr() == def->getName().getStr()) {
+          ++scanFound;
+          break;
+        }
+      }
+    }
+    scanTimes.push_back(getElapsedTime(startTime));
+    if (found != count || scanFound != count) {
+      std::cerr << "Scope lookup mismatch: " << found << " found using the index vs " << scanFound
+        << " scanning.\n";
+    }
+
+    startTime = std::chrono::steady_clock::now();
+    for (Int i = 0; i < count / 10; ++i) {
+      scope->insert(scope->getCount() / 2, Core::Data::Ast::Definition::create({
+        { "name", TiStr(("m" + std::to_string(i)).c_str()) }
+      }));
+    }
+    insertTimes.push_back(getElapsedTime(startTime));
+  }
+  result.appendTime = getMedian(appendTimes);
+  result.indexedLookupTime = getMedian(indexedTimes);
+  result.scanLookupTime = getMedian(scanTimes);
+  result.middleInsertTime = getMedian(insertTimes);
+  return result;
+}
+
+
+/// The summary of all runs over a single source file.
+struct Result
+{
+  std::string name;
+  std::string path;
+  Bool succeeded;
+  Measurement median;
+};
+
+
+Result benchmarkFile(Char const *path, Int runCount, Bool lexerDfa, Bool casts, Bool ingestion)
+{
+  Result result;
+  result.path = path;
+  result.name = std::filesystem::path(path).filename().string();
+  result.succeeded = true;
+
+  std::vector<Measurement> measurements;
+  for (Int i = 0; i < runCount; ++i) {
+    auto m = measureFileInChild(path, lexerDfa, casts, ingestion);
+    if (!m.succeeded) {
+      result.succeeded = false;
+      break;
+    }
+    measurements.push_back(m);
+  }
+  memset(&result.median, 0, sizeof(result.median));
+  if (!result.succeeded) return result;
+
+  // Counts don't change between runs, so only the times and memory need to be summarized.
+  result.median = measurements[0];
+  std::vector<LongWord> values;
+  for (auto const &m : measurements) values.push_back(m.totalTime);
+  result.median.totalTime = getMedian(values);
+  values.clear();
+  for (auto const &m : measurements) values.push_back(m.peakRssKb);
+  result.median.peakRssKb = getMedian(values);
+  for (Int i = 0; i < PhaseStats::PHASE_COUNT; ++i) {
+    values.clear();
+    for (auto const &m : measurements) values.push_back(m.phaseTimes[i]);
+    result.median.phaseTimes[i] = getMedian(values);
+  }
+  values.clear();
+  for (auto const &m : measurements) values.push_back(m.castTime);
+  result.median.castTime = getMedian(values);
+  values.clear();
+  for (auto const &m : measurements) values.push_back(m.chainCastTime);
+  result.median.chainCastTime = getMedian(values);
+  values.clear();
+  for (auto const &m : measurements) values.push_back(m.streamIngestionTime);
+  result.median.streamIngestionTime = getMedian(values);
+  values.clear();
+  for (auto const &m : measurements) values.push_back(m.bulkIngestionTime);
+  result.median.bulkIngestionTime = getMedian(values);
+  return result;
+}
+
+
+void printResult(Result const &result)
+{
+  std::cout << result.name << ":\n";
+  if (!result.succeeded) {
+    std::cout << "  failed\n\n";
+    return;
+  }
+  auto const &m = result.median;
+  for (Int i = 0; i < PhaseStats::PHASE_COUNT; ++i) {
+    std::cout << "  " << PhaseStats::getPhaseName(Phase(static_cast<Phase::_Phase>(i))) << ": "
+      << m.phaseTimes[i] / 1000.0 << " ms\n";
+  }
+  std::cout << "  total: " << m.totalTime / 1000.0 << " ms\n";
+  std::cout << "  tokens: " << m.tokens << " ("
+    << static_cast<LongWord>(getRate(m.tokens, m.phaseTimes[Phase::LEXING])) << " tokens/s)\n";
+  std::cout << "  AST nodes: " << m.astNodes << " ("
+    << static_cast<LongWord>(getRate(m.astNodes, m.phaseTimes[Phase::PARSING])) << " nodes/s)\n";
+  if (m.castCount > 0) {
+    std::cout << "  casts: " << m.castCount << " (" << m.castTime / 1000.0 << " ms using the display, "
+      << m.chainCastTime / 1000.0 << " ms walking the chain)\n";
+  }
+  if (m.bulkIngestionTime > 0) {
+    std::cout << "  ingestion: " << static_cast<LongWord>(getRate(m.bytes, m.streamIngestionTime))
+      << " bytes/s streaming, " << static_cast<LongWord>(getRate(m.bytes, m.bulkIngestionTime))
+      << " bytes/s mapped in bulk\n";
+  }
+  std::cout << "  peak RSS: " << m.peakRssKb << " KB\n\n";
+}
+
+
+std::string escapeJson(std::string const &str)
+{
+  std::string result;
+  for (auto c : str) {
+    if (c == '"' || c == '\\') result += '\\';
+    result += c;
+  }
+  return result;
+}
+
+
+void writeJson(
+  std::ostream &out, std::vector<Result> const &results, LongWord startupTime, ScopeResult const *scopeResult,
+  Int runCount, Bool lexerDfa
+) {
+  out << "{\n";
+  out << "  \"version\": \"" ALUSUS_VERSION ALUSUS_REVISION "\",\n";
+  out << "  \"runs\": " << runCount << ",\n";
+  out << "  \"lexerDfa\": " << (lexerDfa ? "true" : "false") << ",\n";
+  if (startupTime != 0) {
+    out << "  \"startup\": { \"grammarConstructionUs\": " << startupTime << " },\n";
+  }
+  if (scopeResult != 0) {
+    out << "  \"scope\": { \"definitions\": " << scopeResult->definitionCount
+      << ", \"appendUs\": " << scopeResult->appendTime
+      << ", \"indexedLookupUs\": " << scopeResult->indexedLookupTime
+      << ", \"scanLookupUs\": " << scopeResult->scanLookupTime
+      << ", \"middleInsertUs\": " << scopeResult->middleInsertTime << " },\n";
+  }
+  out << "  \"benchmarks\": [";
+  for (Word r = 0; r < results.size(); ++r) {
+    auto const &result = results[r];
+    auto const &m = result.median;
+    out << (r == 0 ? "\n" : ",\n");
+    out << "    {\n";
+    out << "      \"name\": \"" << escapeJson(result.name) << "\",\n";
+    out << "      \"path\": \"" << escapeJson(result.path) << "\",\n";
+    out << "      \"succeeded\": " << (result.succeeded ? "true" : "false") << ",\n";
+    out << "      \"bytes\": " << m.bytes << ",\n";
+    out << "      \"tokens\": " << m.tokens << ",\n";
+    out << "      \"astNodes\": " << m.astNodes << ",\n";
+    out << "      \"notices\": " << m.noticeCount << ",\n";
+    out << "      \"peakRssKb\": " << m.peakRssKb << ",\n";
+    out << "      \"totalUs\": " << m.totalTime << ",\n";
+    out << "      \"phasesUs\": {";
+    for (Int i = 0; i < PhaseStats::PHASE_COUNT; ++i) {
+      out << (i == 0 ? " " : ", ") << "\"" << PhaseStats::getPhaseName(Phase(static_cast<Phase::_Phase>(i)))
+        << "\": " << m.phaseTimes[i];
+    }
+    out << " },\n";
+    if (m.castCount > 0) {
+      out << "      \"casts\": { \"count\": " << m.castCount << ", \"displayUs\": " << m.castTime
+        << ", \"chainUs\": " << m.chainCastTime << " },\n";
+    }
+    if (m.bulkIngestionTime > 0) {
+      out << "      \"ingestion\": { \"streamUs\": " << m.streamIngestionTime << ", \"bulkUs\": " << m.bulkIngestionTime
+        << ", \"streamBytesPerSec\": " << getRate(m.bytes, m.streamIngestionTime)
+        << ", \"bulkBytesPerSec\": " << getRate(m.bytes, m.bulkIngestionTime) << " },\n";
+    }
+    out << "      \"tokensPerSec\": " << getRate(m.tokens, m.phaseTimes[Phase::LEXING]) << ",\n";
+    out << "      \"astNodesPerSec\": " << getRate(m.astNodes, m.phaseTimes[Phase::PARSING]) << "\n";
+    out << "    }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+} // namespace
+
+
+using namespace Benchmarks;
+
+int main(int argc, char **argv)
+{
+  std::filesystem::path repoPath = std::filesystem::path(__FILE__).parent_path().parent_path().parent_path();
+
+  Int runCount = 5;
+  Bool lexerDfa = false;
+  Bool casts = false;
+  Bool ingestion = false;
+  Bool startup = false;
+  Int depCount = 0;
+  Int scopeCount = 0;
+  Char const *jsonPath = 0;
+  std::vector<std::string> paths;
+  for (Int i = 1; i < argc; ++i) {
+    if (compareStr(argv[i], S("--runs")) == 0 && i + 1 < argc) {
+      runCount = atoi(argv[++i]);
+    } else if (compareStr(argv[i], S("--json")) == 0 && i + 1 < argc) {
+      jsonPath = argv[++i];
+    } else if (compareStr(argv[i], S("--lexer-dfa")) == 0) {
+      lexerDfa = true;
+    } else if (compareStr(argv[i], S("--casts")) == 0) {
+      casts = true;
+    } else if (compareStr(argv[i], S("--ingestion")) == 0) {
+      ingestion = true;
+    } else if (compareStr(argv[i], S("--startup")) == 0) {
+      startup = true;
+    } else if (compareStr(argv[i], S("--codegen-deps")) == 0 && i + 1 < argc) {
+      depCount = atoi(argv[++i]);
+    } else if (compareStr(argv[i], S("--scope")) == 0 && i + 1 < argc) {
+      scopeCount = atoi(argv[++i]);
+    } else if (argv[i][0] == '-') {
+      std::cerr << "Usage: alusus_benchmarks [--runs <count>] [--json <file>] [--lexer-dfa] [--casts] [--ingestion] "
+                   "[--startup] [--codegen-deps <count>] [--scope <count>] "
+                   "[<source>...]\n";
+      return EXIT_FAILURE;
+    } else {
+      paths.push_back(std::filesystem::absolute(argv[i]).lexically_normal().string());
+    }
+  }
+  if (runCount < 1) runCount = 1;
+  if (paths.empty()) {
+    paths.push_back((repoPath / "Examples" / "Perf_Test_Samples" / "test2.source").string());
+    paths.push_back((repoPath / "Examples" / "Perf_Test_Samples" / "test3.source").string());
+    paths.push_back((repoPath / "Sources" / "Benchmarks" / "srl_sample.alusus").string());
+  }
+  if (depCount > 0) {
+    auto depPath = std::filesystem::temp_directory_path() / ("codegen_deps_" + std::to_string(depCount) + ".alusus");
+    if (!writeDependencySample(depPath.string().c_str(), depCount)) {
+      std::cerr << "Failed to write " << depPath.string() << "\n";
+      return EXIT_FAILURE;
+    }
+    paths.push_back(depPath.string());
+  }
+
+  std::cout << "Alusus Throughput Benchmarks\n"
+               "Version " ALUSUS_VERSION ALUSUS_REVISION " (" ALUSUS_RELEASE_DATE ")\n\n";
+
+  std::vector<Result> results;
+  auto ret = EXIT_SUCCESS;
+  LongWord startupTime = 0;
+  if (startup) {
+    startupTime = benchmarkStartup(runCount);
+    std::cout << "startup:\n  grammar construction: " << startupTime / 1000.0 << " ms\n\n";
+  }
+  ScopeResult scopeResult;
+  if (scopeCount > 0) {
+    scopeResult = benchmarkScope(scopeCount, runCount);
+    std::cout << "scope with " << scopeCount << " definitions:\n"
+      << "  append: " << scopeResult.appendTime / 1000.0 << " ms\n"
+      << "  lookup all, indexed: " << scopeResult.indexedLookupTime / 1000.0 << " ms\n"
+      << "  lookup all, scanning: " << scopeResult.scanLookupTime / 1000.0 << " ms\n"
+      << "  insert " << scopeCount / 10 << " in the middle: " << scopeResult.middleInsertTime / 1000.0 << " ms\n\n";
+  }
+  for (auto const &path : paths) {
+    results.push_back(benchmarkFile(path.c_str(), runCount, lexerDfa, casts, ingestion));
+    printResult(results.back());
+    if (!results.back().succeeded) ret = EXIT_FAILURE;
+  }
+
+  if (jsonPath != 0) {
+    if (compareStr(jsonPath, S("-")) == 0) {
+      writeJson(std::cout, results, startupTime, scopeCount > 0 ? &scopeResult : 0, runCount, lexerDfa);
+    } else {
+      std::ofstream fout(jsonPath);
+      writeJson(fout, results, startupTime, scopeCount > 0 ? &scopeResult : 0, runCount, lexerDfa);
+    }
+  }
+
+  return ret;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file Core/Basic/PhaseStats.cpp
+ * Contains the implementation of class Core::Basic::PhaseStats.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core { namespace Basic
+{
+
+//==============================================================================
+// Member Functions
+
+void PhaseStats::reset()
+{
+  for (Int i = 0; i < PHASE_COUNT; ++i) {
+    this->times[i] = 0;
+    this->counts[i] = 0;
+    this->depths[i] = 0;
+  }
+}
+
+
+Char const* PhaseStats::getPhaseName(Phase phase)
+{
+  switch (phase.val) {
+    case Phase::LEXING: return S("lexing");
+    case Phase::PARSING: return S("parsing");
+    case Phase::IR_GENERATION: return S("irGeneration");
+    case Phase::OPTIMIZATION: return S("optimization");
+    case Phase::JIT_LINKING: return S("jitLinking");
+  }
+  return S("unknown");
+}
+
+
+PhaseStats* PhaseStats::getSingleton()
+{
+  static PhaseStats *phaseStats = 0;
+  if (phaseStats == 0) {
+    phaseStats = reinterpret_cast<PhaseStats*>(GLOBAL_STORAGE->getObject(S("Core::Basic::PhaseStats")));
+    if (phaseStats == 0) {
+      phaseStats = new PhaseStats;
+      GLOBAL_STORAGE->setObject(S("Core::Basic::PhaseStats"), reinterpret_cast<void*>(phaseStats));
+    }
+  }
+  return phaseStats;
+}
+
+} } // namespace
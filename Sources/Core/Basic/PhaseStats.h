@@ -0,0 +1,130 @@
+/**
+ * @file Core/Basic/PhaseStats.h
+ * Contains the header of class Core::Basic::PhaseStats.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_BASIC_PHASE_STATS_H
+#define CORE_BASIC_PHASE_STATS_H
+
+namespace Core { namespace Basic
+{
+
+/**
+ * @brief Accumulates the time spent in each compilation phase.
+ * @ingroup basic_utils
+ *
+ * This singleton is shared among all libraries, so phases implemented by
+ * language libraries (like code generation in Spp) are recorded into the same
+ * object that the benchmarks read from. Nested entries into the same phase are
+ * only counted once.
+ */
+class PhaseStats
+{
+  //============================================================================
+  // Types
+
+  public: s_enum(Phase, LEXING, PARSING, IR_GENERATION, OPTIMIZATION, JIT_LINKING);
+
+  public: static constexpr Int PHASE_COUNT = 5;
+
+  /// Records the time between its construction and destruction into the given phase.
+  public: class Timer
+  {
+    private: Phase phase;
+    private: Bool outermost;
+    private: std::chrono::steady_clock::time_point startTime;
+
+    public: Timer(Phase p) : phase(p)
+    {
+      this->outermost = PhaseStats::getSingleton()->enter(p);
+      if (this->outermost) this->startTime = std::chrono::steady_clock::now();
+    }
+
+    public: ~Timer()
+    {
+      if (this->outermost) {
+        PhaseStats::getSingleton()->add(this->phase, std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - this->startTime
+        ).count());
+      }
+      PhaseStats::getSingleton()->leave(this->phase);
+    }
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: std::atomic<LongWord> times[PHASE_COUNT];
+  private: std::atomic<Word> counts[PHASE_COUNT];
+  private: Int depths[PHASE_COUNT];
+
+
+  //============================================================================
+  // Constructor
+
+  /// Prevent the singleton class from being inistantiated.
+  private: PhaseStats()
+  {
+    this->reset();
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Adds the given duration, in microseconds, to the given phase.
+  public: void add(Phase phase, LongWord microseconds)
+  {
+    this->times[phase.val] += microseconds;
+    ++this->counts[phase.val];
+  }
+
+  /// Returns the total time, in microseconds, spent in the given phase.
+  public: LongWord getTime(Phase phase) const
+  {
+    return this->times[phase.val];
+  }
+
+  /// Returns the number of times the given phase was entered.
+  public: Word getCount(Phase phase) const
+  {
+    return this->counts[phase.val];
+  }
+
+  public: void reset();
+
+  /// Marks entering a phase and returns whether this is the outermost entry.
+  public: Bool enter(Phase phase)
+  {
+    return this->depths[phase.val]++ == 0;
+  }
+
+  public: void leave(Phase phase)
+  {
+    --this->depths[phase.val];
+  }
+
+  public: static Char const* getPhaseName(Phase phase);
+
+  /// Get the singleton object.
+  public: static PhaseStats* getSingleton();
+
+}; // class
+
+} } // namespace
+
+/**
+ * @brief A shortcut to access the phase stats singleton.
+ * @ingroup basic_utils
+ */
+#define PHASE_STATS Core::Basic::PhaseStats::getSingleton()
+
+#endif
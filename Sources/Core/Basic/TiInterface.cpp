@@ -51,12 +51,7 @@ InterfaceTypeInfo const * TiInterface::getTypeInfo()
  */
 Bool TiInterface::isInterfaceDerivedFrom(TypeInfo const *info) const
 {
-  TypeInfo const *i = this->getMyInterfaceInfo();
-  while (i != 0) {
-    if (i == info) return true;
-    i = i->getBaseTypeInfo();
-  }
-  return false;
+  return this->getMyInterfaceInfo()->isDerivedFrom(info);
 }
 
 } // namespace
@@ -41,22 +41,4 @@ ObjectTypeInfo const* TiObject::getTypeInfo()
   return type_info;
 }
 
-
-/**
- * Check if this object is of the given type, or a derived type.
- *
- * @return Returns true if the given type info is for the class from which
- *         this object is instantiated, or for the class from which this
- *         object's class is derived, false otherwise.
- */
-Bool TiObject::isDerivedFrom(TypeInfo const *info) const
-{
-  TypeInfo const *i = this->getMyTypeInfo();
-  while (i != 0) {
-    if (i == info) return true;
-    i = i->getBaseTypeInfo();
-  }
-  return false;
-}
-
 } // namespace
@@ -89,7 +89,10 @@ class TiObject
   public: static ObjectTypeInfo const* getTypeInfo();
 
   /// Check if this object is of the given type, or a derived type.
-  public: Bool isDerivedFrom(TypeInfo const *info) const;
+  public: Bool isDerivedFrom(TypeInfo const *info) const
+  {
+    return this->getMyTypeInfo()->isDerivedFrom(info);
+  }
 
   /**
    * @brief A template equivalent to isDerivedFrom.
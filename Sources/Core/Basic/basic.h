@@ -673,6 +673,7 @@ extern std::istream &inStream;
 #include "SubsetIndex.h"
 
 #include "GlobalStorage.h"
+#include "PhaseStats.h"
 
 #include "type_names.h"
 #include "type_info.h"
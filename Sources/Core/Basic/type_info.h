@@ -24,10 +24,25 @@ namespace Core { namespace Basic
  * @ingroup basic_utils
  *
  * Classes derived from TiObject uses this object to pass the type
- * information at run time.
+ * information at run time. The layout of this class is mirrored by TypeInfo
+ * in Srt/Core/Basic.alusus, so changes to the member variables must be
+ * reflected there.
  */
 class TypeInfo
 {
+  //============================================================================
+  // Constants
+
+  /**
+   * @brief The maximum depth recorded in the ancestor display.
+   *
+   * Types that are nested deeper than this in the hierarchy still work, but
+   * checking whether a type is derived from them falls back to walking the
+   * base type chain.
+   */
+  public: static constexpr Int MAX_DISPLAY_DEPTH = 16;
+
+
   //============================================================================
   // Member Variables
 
@@ -70,6 +85,19 @@ class TypeInfo
   /// Pointer to the type info of the base type.
   private: TypeInfo const* baseTypeInfo;
 
+  /// The number of base types above this type in the hierarchy.
+  private: Int depth;
+
+  /**
+   * @brief The ancestor display of this type.
+   *
+   * Entry i is the ancestor at depth i, with the root type at 0 and this type
+   * itself at `depth`. This allows checking whether a type is derived from
+   * another with a single comparison regardless of how deep the hierarchy is.
+   * Only the first MAX_DISPLAY_DEPTH levels are recorded.
+   */
+  private: TypeInfo const* display[MAX_DISPLAY_DEPTH];
+
 
   //============================================================================
   // Constructor
@@ -96,6 +124,18 @@ class TypeInfo
     baseTypeInfo(baseTypeInfo)
   {
     this->uniqueName = this->url + "/" + this->packageName + "/" + this->typeNamespace + "." + this->typeName;
+
+    // Base type infos are always created before the types derived from them, so their displays are ready.
+    if (baseTypeInfo == 0) {
+      this->depth = 0;
+    } else {
+      this->depth = baseTypeInfo->depth + 1;
+      for (Int i = 0; i < baseTypeInfo->depth && i < MAX_DISPLAY_DEPTH; ++i) {
+        this->display[i] = baseTypeInfo->display[i];
+      }
+      if (baseTypeInfo->depth < MAX_DISPLAY_DEPTH) this->display[baseTypeInfo->depth] = baseTypeInfo;
+    }
+    if (this->depth < MAX_DISPLAY_DEPTH) this->display[this->depth] = this;
   }
 
 
@@ -158,6 +198,28 @@ class TypeInfo
     return this->baseTypeInfo;
   }
 
+  /// Get the number of base types above this type in the hierarchy.
+  public: Int getDepth() const
+  {
+    return this->depth;
+  }
+
+  /**
+   * @brief Check if this type is the given type, or is derived from it.
+   *
+   * This is a single lookup into the ancestor display unless the given type
+   * is nested deeper than MAX_DISPLAY_DEPTH, in which case the base type
+   * chain is walked instead.
+   */
+  public: Bool isDerivedFrom(TypeInfo const *info) const
+  {
+    if (info == 0 || info->depth > this->depth) return false;
+    if (info->depth < MAX_DISPLAY_DEPTH) return this->display[info->depth] == info;
+    TypeInfo const *i = this;
+    while (i->depth > info->depth) i = i->baseTypeInfo;
+    return i == info;
+  }
+
 }; // class
 
 
@@ -15,6 +15,31 @@
 namespace Core::Data::Ast
 {
 
+//==============================================================================
+// Member Functions
+
+void Definition::setName(Char const *n)
+{
+  auto scope = ti_cast<Scope>(this->getOwner());
+  if (scope == 0) {
+    this->name = n;
+    return;
+  }
+  // Keep the owner scope's definition index in sync.
+  Str oldName = this->name.getStr();
+  this->name = n;
+  if (oldName != this->name.getStr()) scope->onDefinitionRenamed(this, oldName);
+}
+
+
+void Definition::setTarget(TioSharedPtr const &t)
+{
+  UPDATE_OWNED_SHAREDPTR(this->target, t);
+  auto scope = ti_cast<Scope>(this->getOwner());
+  if (scope != 0) scope->onDefinitionRetargeted(this);
+}
+
+
 //==============================================================================
 // Printable Implementation
 
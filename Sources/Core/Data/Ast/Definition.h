@@ -74,13 +74,10 @@ class Definition : public Node,
   //============================================================================
   // Member Functions
 
-  public: void setName(Char const *n)
-  {
-    this->name = n;
-  }
+  public: void setName(Char const *n);
   public: void setName(TiStr const *n)
   {
-    this->name = n == 0 ? "" : n->get();
+    this->setName(n == 0 ? S("") : n->get());
   }
 
   public: TiStr const& getName() const
@@ -88,10 +85,7 @@ class Definition : public Node,
     return this->name;
   }
 
-  public: void setTarget(TioSharedPtr const &t)
-  {
-    UPDATE_OWNED_SHAREDPTR(this->target, t);
-  }
+  public: void setTarget(TioSharedPtr const &t);
   private: void setTarget(TiObject *t)
   {
     this->setTarget(getSharedPtr(t));
@@ -0,0 +1,113 @@
+/**
+ * @file Core/Data/Ast/ExtraSlots.h
+ * Contains the header of class Core::Data::Ast::ExtraSlots.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_AST_EXTRASLOTS_H
+#define CORE_DATA_AST_EXTRASLOTS_H
+
+namespace Core::Data::Ast
+{
+
+/**
+ * @brief Storage for the extra data attached to AST nodes.
+ * @ingroup core_data
+ *
+ * Extras are keyed by slot ids interned through ID_GENERATOR rather than by
+ * name, so accessing them only compares integers. Nodes rarely have more
+ * than a handful of extras, so the slots are kept in a compact vector rather
+ * than a map.
+ */
+class ExtraSlots
+{
+  //============================================================================
+  // Types
+
+  private: struct Slot
+  {
+    Word id;
+    TioSharedPtr obj;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: std::vector<Slot> slots;
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void set(Word id, TioSharedPtr const &obj)
+  {
+    for (auto &slot : this->slots) {
+      if (slot.id == id) {
+        slot.obj = obj;
+        return;
+      }
+    }
+    this->slots.push_back({ id, obj });
+  }
+
+  public: TioSharedPtr const& get(Word id) const
+  {
+    for (auto const &slot : this->slots) {
+      if (slot.id == id) return slot.obj;
+    }
+    return TioSharedPtr::null;
+  }
+
+  public: void remove(Word id)
+  {
+    for (auto it = this->slots.begin(); it != this->slots.end(); ++it) {
+      if (it->id == id) {
+        this->slots.erase(it);
+        return;
+      }
+    }
+  }
+
+  /// Removes all the slots with the given ids in a single pass.
+  public: void remove(Word const *ids, Int count)
+  {
+    Int j = 0;
+    for (Int i = 0; i < this->slots.size(); ++i) {
+      Bool found = false;
+      for (Int k = 0; k < count; ++k) {
+        if (this->slots[i].id == ids[k]) {
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        if (i != j) this->slots[j] = std::move(this->slots[i]);
+        ++j;
+      }
+    }
+    this->slots.resize(j);
+  }
+
+  public: Word getCount() const
+  {
+    return this->slots.size();
+  }
+
+  /// Get the slot id of the extra with the given name.
+  public: static Word getId(Char const *name)
+  {
+    return ID_GENERATOR->getId(name);
+  }
+
+}; // class
+
+} // namespace
+
+#endif
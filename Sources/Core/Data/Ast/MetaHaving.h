@@ -100,9 +100,32 @@ class MetaHaving : public TiInterface
     return sl;
   }
 
-  public: virtual void setExtra(Char const *name, TioSharedPtr const &obj) = 0;
-  public: virtual void removeExtra(Char const *name) = 0;
-  public: virtual TioSharedPtr const& getExtra(Char const *name) const = 0;
+  public: virtual void setExtra(Word id, TioSharedPtr const &obj) = 0;
+  public: virtual void removeExtra(Word id) = 0;
+  public: virtual void removeExtras(Word const *ids, Int count) = 0;
+  public: virtual TioSharedPtr const& getExtra(Word id) const = 0;
+
+  /**
+   * @brief Set an extra by name.
+   *
+   * The name is interned into a slot id with every call, so frequently
+   * accessed extras should get their ids once from ExtraSlots::getId and use
+   * the id based functions instead.
+   */
+  public: void setExtra(Char const *name, TioSharedPtr const &obj)
+  {
+    this->setExtra(ExtraSlots::getId(name), obj);
+  }
+
+  public: void removeExtra(Char const *name)
+  {
+    this->removeExtra(ExtraSlots::getId(name));
+  }
+
+  public: TioSharedPtr const& getExtra(Char const *name) const
+  {
+    return this->getExtra(ExtraSlots::getId(name));
+  }
 
 }; // class
 
@@ -113,7 +136,7 @@ class MetaHaving : public TiInterface
 #define IMPLEMENT_METAHAVING(type) \
   private: Core::Basic::TiWord prodId = UNKNOWN_ID; \
   private: Core::Basic::SharedPtr<Core::Data::SourceLocation> sourceLocation; \
-  private: Core::Basic::SharedMap<Core::Basic::TiObject> extras; \
+  private: Core::Data::Ast::ExtraSlots extras; \
   public: using MetaHaving::setProdId; \
   public: virtual void setProdId(Word id) \
   { \
@@ -136,20 +159,24 @@ class MetaHaving : public TiInterface
   { \
     return this->sourceLocation; \
   } \
-  public: virtual void setExtra(Char const *name, TioSharedPtr const &obj) \
+  public: using MetaHaving::setExtra; \
+  public: virtual void setExtra(Word id, TioSharedPtr const &obj) \
+  { \
+    this->extras.set(id, obj); \
+  } \
+  public: using MetaHaving::removeExtra; \
+  public: virtual void removeExtra(Word id) \
   { \
-    this->extras.set(name, obj); \
+    this->extras.remove(id); \
   } \
-  public: virtual void removeExtra(Char const *name) \
+  public: virtual void removeExtras(Word const *ids, Int count) \
   { \
-    auto index = this->extras.findIndex(name); \
-    if (index != -1) this->extras.remove(index); \
+    this->extras.remove(ids, count); \
   } \
-  public: virtual TioSharedPtr const& getExtra(Char const *name) const \
+  public: using MetaHaving::getExtra; \
+  public: virtual TioSharedPtr const& getExtra(Word id) const \
   { \
-    auto index = this->extras.findIndex(name); \
-    if (index == -1) return TioSharedPtr::null; \
-    else return this->extras.get(index); \
+    return this->extras.get(id); \
   }
 
 } // namespace
@@ -15,28 +15,118 @@
 namespace Core::Data::Ast
 {
 
+//==============================================================================
+// Static Variables
+
+Word Scope::generation = 0;
+
+
 //==============================================================================
 // Inherited Functions
 
 void Scope::onAdded(Int index)
 {
+  this->onDefinitionsChanged();
   this->bridgesIndex.onAdded(index, ti_cast<Bridge>(this->getElement(index)) != 0);
+  if (index != this->getCount() - 1) this->shiftDefinitionIndex(index, 1);
+  this->indexedNames.insert(this->indexedNames.begin() + index, Str());
+  this->addToDefinitionIndex(index);
   List::onAdded(index);
 }
 
 void Scope::onUpdated(Int index)
 {
+  this->onDefinitionsChanged();
   this->bridgesIndex.onUpdated(index, ti_cast<Bridge>(this->getElement(index)) != 0);
+  this->removeFromDefinitionIndex(index);
+  this->addToDefinitionIndex(index);
   List::onUpdated(index);
 }
 
 void Scope::onRemoved(Int index)
 {
+  this->onDefinitionsChanged();
   this->bridgesIndex.onRemoved(index);
+  this->removeFromDefinitionIndex(index);
+  this->indexedNames.erase(this->indexedNames.begin() + index);
+  if (index != this->getCount()) this->shiftDefinitionIndex(index, -1);
   List::onRemoved(index);
 }
 
 
+//==============================================================================
+// Definition Lookup Functions
+
+Int Scope::findDefinitionIndex(Str const &name, Int startIndex) const
+{
+  auto iter = this->definitionIndex.find(name);
+  if (iter == this->definitionIndex.end()) return -1;
+  auto pos = std::lower_bound(iter->second.begin(), iter->second.end(), startIndex);
+  return pos == iter->second.end() ? -1 : *pos;
+}
+
+
+void Scope::onDefinitionRenamed(Definition *def, Str const &oldName)
+{
+  this->onDefinitionsChanged();
+  auto iter = this->definitionIndex.find(oldName);
+  if (iter == this->definitionIndex.end()) return;
+  for (auto index : iter->second) {
+    if (this->getElement(index) == def) {
+      this->removeFromDefinitionIndex(index);
+      this->addToDefinitionIndex(index);
+      return;
+    }
+  }
+}
+
+
+void Scope::addToDefinitionIndex(Int index)
+{
+  auto def = ti_cast<Definition>(this->getElement(index));
+  if (def == 0) return;
+  auto &indices = this->definitionIndex[def->getName().getStr()];
+  indices.insert(std::lower_bound(indices.begin(), indices.end(), index), index);
+  this->indexedNames[index] = def->getName().getStr();
+}
+
+
+void Scope::removeFromDefinitionIndex(Int index)
+{
+  auto iter = this->definitionIndex.find(this->indexedNames[index]);
+  if (iter == this->definitionIndex.end()) return;
+  auto &indices = iter->second;
+  auto pos = std::lower_bound(indices.begin(), indices.end(), index);
+  if (pos != indices.end() && *pos == index) {
+    indices.erase(pos);
+    if (indices.empty()) this->definitionIndex.erase(iter);
+  }
+  this->indexedNames[index] = Str();
+}
+
+
+/**
+ * Adds the given delta to all indices that are at or after the given index.
+ * Used to keep the index in sync when elements are inserted or removed in the
+ * middle of the scope.
+ *
+ * This visits every name in the scope, so inserting in the middle costs
+ * O(names) on top of the O(elements) move done by the list itself. Scopes
+ * are almost always built by appending, which skips the shift, while lookups
+ * happen far more often, so the index is kept keyed by name rather than
+ * bucketed by position.
+ */
+void Scope::shiftDefinitionIndex(Int index, Int delta)
+{
+  for (auto &entry : this->definitionIndex) {
+    auto &indices = entry.second;
+    for (auto pos = std::lower_bound(indices.begin(), indices.end(), index); pos != indices.end(); ++pos) {
+      *pos += delta;
+    }
+  }
+}
+
+
 //==============================================================================
 // Bridge Retrieval Functions
 
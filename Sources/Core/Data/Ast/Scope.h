@@ -25,11 +25,34 @@ class Scope : public List
   OBJECT_FACTORY(Scope);
 
 
+  //============================================================================
+  // Types
+
+  public: typedef std::unordered_map<Str, std::vector<Int>, std::hash<Str>> DefinitionIndex;
+
+
   //============================================================================
   // Memver Variables
 
   private: SubsetIndex bridgesIndex;
 
+  /// The sorted indices of the definitions in this scope grouped by name.
+  private: DefinitionIndex definitionIndex;
+
+  /**
+   * @brief The name under which each element is recorded in definitionIndex.
+   * This allows the old entry to be removed after the element is replaced or
+   * removed. Elements other than definitions have an empty name.
+   */
+  private: std::vector<Str> indexedNames;
+
+  /**
+   * @brief Incremented whenever the definitions of any scope change, except
+   * those that track their changes locally. Allows caches of lookup results to detect that the results they hold
+   * might no longer be valid.
+   */
+  private: static Word generation;
+
 
   //============================================================================
   // Implementations
@@ -61,6 +84,49 @@ class Scope : public List
 
   /// @}
 
+  /**
+   * @brief Called whenever the definitions or bridges of this scope change.
+   * Advances the global generation by default. Derived scopes whose
+   * definitions are only visible to lookups within them can track the change
+   * locally instead.
+   */
+  protected: virtual void onDefinitionsChanged()
+  {
+    ++Scope::generation;
+  }
+
+  /// @name Definition Lookup Functions
+  /// @{
+
+  /**
+   * @brief Find the next definition with the given name.
+   *
+   * Looks up the name in the definitions index rather than scanning all the
+   * elements of the scope.
+   * @param name The name of the definition to look for.
+   * @param startIndex The element index from which to start the search.
+   * @return The element index of the first definition with the given name
+   *         at or after startIndex, or -1 if none is found.
+   */
+  public: Int findDefinitionIndex(Str const &name, Int startIndex = 0) const;
+
+  /// Update the definitions index after the given definition is renamed.
+  public: void onDefinitionRenamed(Definition *def, Str const &oldName);
+
+  /// Called after the target of the given definition is replaced.
+  public: void onDefinitionRetargeted(Definition *def)
+  {
+    this->onDefinitionsChanged();
+  }
+
+  private: void addToDefinitionIndex(Int index);
+
+  private: void removeFromDefinitionIndex(Int index);
+
+  private: void shiftDefinitionIndex(Int index, Int delta);
+
+  /// @}
+
   /// @name Bridge Retrieval Functions
   /// @{
 
@@ -73,6 +139,23 @@ class Scope : public List
 
   /// @}
 
+  /// @name Generation Functions
+  /// @{
+
+  /**
+   * @brief Get the current mutation generation of scopes.
+   * The generation changes whenever a definition or a bridge is added to,
+   * replaced in, or removed from any scope, and whenever a definition in a
+   * scope is renamed or retargeted, unless the scope tracks the change
+   * locally.
+   */
+  public: static Word getGeneration()
+  {
+    return Scope::generation;
+  }
+
+  /// @}
+
 }; // class
 
 } // namespace
@@ -295,4 +295,57 @@ Bool isEqual(TiObject *obj1, TiObject *obj2)
   return true;
 }
 
+
+/**
+ * @brief Computes a structural hash of the given tree.
+ *
+ * Trees that are equal according to isEqual always get the same hash, which
+ * makes this suitable for indexing trees that are later compared using
+ * isEqual. Only the types, basic values, and container elements are hashed.
+ */
+Word computeHash(TiObject *obj)
+{
+  if (obj == 0) return 0;
+
+  Word hash = std::hash<void const*>()(obj->getMyTypeInfo());
+  auto combine = [&hash](Word value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+
+  if (obj->isDerivedFrom<TiInt>()) {
+    combine(std::hash<Int>()(static_cast<TiInt*>(obj)->get()));
+    return hash;
+  } else if (obj->isDerivedFrom<TiWord>()) {
+    combine(std::hash<Word>()(static_cast<TiWord*>(obj)->get()));
+    return hash;
+  } else if (obj->isDerivedFrom<TiFloat>()) {
+    combine(std::hash<Float>()(static_cast<TiFloat*>(obj)->get()));
+    return hash;
+  } else if (obj->isDerivedFrom<TiBool>()) {
+    combine(static_cast<TiBool*>(obj)->get() ? 1 : 0);
+    return hash;
+  } else if (obj->isDerivedFrom<TiStr>()) {
+    combine(std::hash<Str>()(static_cast<TiStr*>(obj)->getStr()));
+    return hash;
+  } else if (obj->isDerivedFrom<TiWStr>()) {
+    return hash;
+  }
+
+  auto bindings = ti_cast<Binding>(obj);
+  if (bindings != 0) {
+    for (Int i = 0; i < bindings->getMemberCount(); ++i) {
+      auto member = bindings->getMember(i);
+      // Skip source locations since they are not part of the structure of the tree.
+      if (member != 0 && !member->isDerivedFrom<SourceLocation>()) combine(computeHash(member));
+    }
+  }
+
+  auto container = ti_cast<Containing<TiObject>>(obj);
+  if (container != 0) {
+    for (Int i = 0; i < container->getElementCount(); ++i) combine(computeHash(container->getElement(i)));
+  }
+
+  return hash;
+}
+
 } // namespace
@@ -108,9 +108,11 @@ template <class T> SharedPtr<T> clone(T *obj, SourceLocation *sl = 0)
 }
 
 Bool isEqual(TiObject *obj1, TiObject *obj2);
+Word computeHash(TiObject *obj);
 
 } // namespace
 
+#include "ExtraSlots.h"
 #include "MetaHaving.h"
 #include "Mergeable.h"
 
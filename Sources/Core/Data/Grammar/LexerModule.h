@@ -40,6 +40,18 @@ class LexerModule : public Module, public CacheHaving
 
   private: CharBasedDecisionCache charBasedDecisionCache;
 
+  /**
+   * @brief The DFA compiled from this module's tokens.
+   *
+   * This is set by the lexer the first time it needs it and is dropped along
+   * with the rest of the cache whenever the grammar is modified. It can be
+   * null even after compilation if the grammar can't be compiled into a DFA.
+   */
+  private: SharedPtr<TiObject> compiledDfa;
+
+  /// Whether compiling a DFA has already been attempted since the cache was last cleared.
+  private: Bool dfaCompilationAttempted = false;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -75,6 +87,22 @@ class LexerModule : public Module, public CacheHaving
     return &this->charBasedDecisionCache;
   }
 
+  public: void setCompiledDfa(SharedPtr<TiObject> const &dfa)
+  {
+    this->compiledDfa = dfa;
+    this->dfaCompilationAttempted = true;
+  }
+
+  public: SharedPtr<TiObject> const& getCompiledDfa() const
+  {
+    return this->compiledDfa;
+  }
+
+  public: Bool isDfaCompilationAttempted() const
+  {
+    return this->dfaCompilationAttempted;
+  }
+
 
   //============================================================================
   // CacheHaving Implementation
@@ -83,6 +111,8 @@ class LexerModule : public Module, public CacheHaving
   public: virtual void clearCache()
   {
     this->charBasedDecisionCache.clear();
+    this->compiledDfa.reset();
+    this->dfaCompilationAttempted = false;
   }
 
 }; // class
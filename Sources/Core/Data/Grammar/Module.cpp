@@ -47,7 +47,12 @@ void Module::finalizeSet(
 ) {
   if (obj != 0 && obj->isDerivedFrom<Node>()) {
     obj.s_cast_get<Node>()->setOwner(this);
-    setTreeIds(obj.get());
+    // The key is already known, so there is no need to search this module for the object to generate its ID.
+    StrStream id;
+    generateId(this, id);
+    if (id.tellp() != 0) id << C('.');
+    id << key;
+    setTreeIds(obj.get(), id.str().c_str());
   }
 }
 
@@ -146,33 +146,39 @@ void setTreeIds(TiObject *obj)
 }
 
 
-void setTreeIds(TiObject *obj, const Char *id)
+/// Sets the IDs of a tree, building the IDs of all the tree's objects in a single buffer.
+static void setSubtreeIds(TiObject *obj, std::string &id)
 {
   IdHaving *idh = ti_cast<IdHaving>(obj);
-  if (idh != 0) idh->setId(ID_GENERATOR->getId(id));
+  if (idh != 0) idh->setId(ID_GENERATOR->getId(id.c_str()));
 
-  StrStream childId;
+  auto size = id.size();
   MapContaining<TiObject> *map; Containing<TiObject> *list;
   if ((map = ti_cast<MapContaining<TiObject>>(obj)) != 0) {
     for (Int i = 0; static_cast<Word>(i) < map->getElementCount(); ++i) {
-      childId.str(std::string());
-      childId << id;
-      if (childId.tellp() != 0) childId << C('.');
-      childId << map->getElementKey(i);
-      setTreeIds(map->getElement(i), childId.str().c_str());
+      if (size != 0) id += C('.');
+      id += map->getElementKey(i);
+      setSubtreeIds(map->getElement(i), id);
+      id.resize(size);
     }
   } else if ((list = ti_cast<Containing<TiObject>>(obj)) != 0) {
     for (Int i = 0; static_cast<Word>(i) < list->getElementCount(); ++i) {
-      childId.str(std::string());
-      childId << id;
-      if (childId.tellp() != 0) childId << C('.');
-      childId << i;
-      setTreeIds(list->getElement(i), childId.str().c_str());
+      if (size != 0) id += C('.');
+      id += std::to_string(i);
+      setSubtreeIds(list->getElement(i), id);
+      id.resize(size);
     }
   }
 }
 
 
+void setTreeIds(TiObject *obj, const Char *id)
+{
+  std::string buffer(id);
+  setSubtreeIds(obj, buffer);
+}
+
+
 void generateId(Node *obj, StrStream &id)
 {
   if (obj == 0) {
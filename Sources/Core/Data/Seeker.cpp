@@ -271,16 +271,15 @@ Seeker::Verb Seeker::_set_identifierOnScope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, SetCallback const &cb, Word flags
 ) {
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(Action::TARGET_MATCH, obj);
-      if (isPerform(verb)) {
-        def->setTarget(getSharedPtr(obj));
-      }
-      if (!Seeker::isMove(verb)) break;
+  auto const &name = identifier->getValue().getStr();
+  for (Int i = scope->findDefinitionIndex(name); i != -1; i = scope->findDefinitionIndex(name, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(Action::TARGET_MATCH, obj);
+    if (isPerform(verb)) {
+      def->setTarget(getSharedPtr(obj));
     }
+    if (!Seeker::isMove(verb)) break;
   }
   if (Seeker::isMove(verb)) {
     TiObject *obj = 0;
@@ -424,17 +423,19 @@ Seeker::Verb Seeker::_remove_identifierOnScope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, RemoveCallback const &cb, Word flags
 ) {
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(Action::TARGET_MATCH, obj);
-      if (isPerform(verb)) {
-        scope->remove(i);
-        --i;
-      }
-      if (!Seeker::isMove(verb)) return verb;
+  auto const &name = identifier->getValue().getStr();
+  Int i = scope->findDefinitionIndex(name);
+  while (i != -1) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(Action::TARGET_MATCH, obj);
+    if (isPerform(verb)) {
+      scope->remove(i);
+    } else {
+      ++i;
     }
+    if (!Seeker::isMove(verb)) return verb;
+    i = scope->findDefinitionIndex(name, i);
   }
   return verb;
 }
@@ -587,26 +588,25 @@ Seeker::Verb Seeker::_foreach_identifierAtScope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, ForeachCallback const &cb, Word flags
 ) {
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      if (obj->isDerivedFrom<Ast::Alias>()) {
-        verb = cb(Action::ALIAS_TRACE_START, obj);
-        if (verb == Verb::SKIP) return Verb::MOVE;
-        else if (!Seeker::isMove(verb)) return verb;
-        PREPARE_SELF(seeker, Seeker);
-        auto alias = static_cast<Ast::Alias*>(obj);
-        verb = seeker->foreach(
-          alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
-        );
-        if (!Seeker::isMove(verb)) return verb;
-        verb = cb(Action::ALIAS_TRACE_END, obj);
-        if (verb != Verb::MOVE) return verb;
-      } else {
-        verb = cb(Action::TARGET_MATCH, obj);
-        if (!Seeker::isMove(verb)) return verb;
-      }
+  auto const &name = identifier->getValue().getStr();
+  for (Int i = scope->findDefinitionIndex(name); i != -1; i = scope->findDefinitionIndex(name, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    if (obj->isDerivedFrom<Ast::Alias>()) {
+      verb = cb(Action::ALIAS_TRACE_START, obj);
+      if (verb == Verb::SKIP) return Verb::MOVE;
+      else if (!Seeker::isMove(verb)) return verb;
+      PREPARE_SELF(seeker, Seeker);
+      auto alias = static_cast<Ast::Alias*>(obj);
+      verb = seeker->foreach(
+        alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
+      );
+      if (!Seeker::isMove(verb)) return verb;
+      verb = cb(Action::ALIAS_TRACE_END, obj);
+      if (verb != Verb::MOVE) return verb;
+    } else {
+      verb = cb(Action::TARGET_MATCH, obj);
+      if (!Seeker::isMove(verb)) return verb;
     }
   }
 
@@ -642,26 +642,25 @@ Seeker::Verb Seeker::_foreach_identifierOnScope(
   TiObject *self, Data::Ast::Identifier *identifier, Data::Ast::Scope *scope, ForeachCallback const &cb, Word flags
 ) {
   Verb verb = Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      if (obj->isDerivedFrom<Ast::Alias>()) {
-        verb = cb(Action::ALIAS_TRACE_START, obj);
-        if (verb == Verb::SKIP) return Verb::MOVE;
-        else if (!Seeker::isMove(verb)) return verb;
-        PREPARE_SELF(seeker, Seeker);
-        auto alias = static_cast<Ast::Alias*>(obj);
-        verb = seeker->foreach(
-          alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
-        );
-        if (!Seeker::isMove(verb)) break;
-        verb = cb(Action::ALIAS_TRACE_END, obj);
-        if (verb != Verb::MOVE) return verb;
-      } else {
-        verb = cb(Action::TARGET_MATCH, obj);
-        if (!Seeker::isMove(verb)) break;
-      }
+  auto const &name = identifier->getValue().getStr();
+  for (Int i = scope->findDefinitionIndex(name); i != -1; i = scope->findDefinitionIndex(name, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    if (obj->isDerivedFrom<Ast::Alias>()) {
+      verb = cb(Action::ALIAS_TRACE_START, obj);
+      if (verb == Verb::SKIP) return Verb::MOVE;
+      else if (!Seeker::isMove(verb)) return verb;
+      PREPARE_SELF(seeker, Seeker);
+      auto alias = static_cast<Ast::Alias*>(obj);
+      verb = seeker->foreach(
+        alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
+      );
+      if (!Seeker::isMove(verb)) break;
+      verb = cb(Action::ALIAS_TRACE_END, obj);
+      if (verb != Verb::MOVE) return verb;
+    } else {
+      verb = cb(Action::TARGET_MATCH, obj);
+      if (!Seeker::isMove(verb)) break;
     }
   }
   return verb;
@@ -0,0 +1,661 @@
+/**
+ * @file Core/Main/AstCache.cpp
+ * Contains the implementation of class Core::Main::AstCache.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+#ifndef WINDOWS
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+
+namespace Core::Main
+{
+
+//==============================================================================
+// Entry Format
+
+/*
+ * An entry starts with the magic bytes and the format version, followed by
+ * the signature of the process that recorded it, the path of the source file,
+ * and the size and hash of the source content. The body follows, prefixed by
+ * its size and hash. The body starts with a table of the strings referred to
+ * by the events, like type names, file names, and ID descriptions, followed by
+ * the events. Each event starts with its type and ends with its AST, and the
+ * events end with an END event. Values start with a ValueTag and objects are
+ * written recursively. All numbers are written in the native byte order since
+ * an entry is only loaded by the build that recorded it.
+ */
+
+static Char const entryMagic[] = { 'A', 'A', 'S', 'T' };
+
+/// Must be bumped whenever the format changes.
+static Word const entryVersion = 1;
+
+static Word const endOfMembers = 0xFFFF;
+
+
+//==============================================================================
+// Constructor
+
+AstCache::AstCache()
+{
+  // Initialize type info for AST types since entries refer to types by their unique names, and the entry can be
+  // loaded before the parser creates any object of these types.
+  Data::Ast::Alias::getTypeInfo();
+  Data::Ast::Bracket::getTypeInfo();
+  Data::Ast::Bridge::getTypeInfo();
+  Data::Ast::Definition::getTypeInfo();
+  Data::Ast::GenericCommand::getTypeInfo();
+  Data::Ast::InfixOperator::getTypeInfo();
+  Data::Ast::AssignmentOperator::getTypeInfo();
+  Data::Ast::ComparisonOperator::getTypeInfo();
+  Data::Ast::AdditionOperator::getTypeInfo();
+  Data::Ast::MultiplicationOperator::getTypeInfo();
+  Data::Ast::BitwiseOperator::getTypeInfo();
+  Data::Ast::LogOperator::getTypeInfo();
+  Data::Ast::LinkOperator::getTypeInfo();
+  Data::Ast::ConditionalOperator::getTypeInfo();
+  Data::Ast::List::getTypeInfo();
+  Data::Ast::Map::getTypeInfo();
+  Data::Ast::MergeList::getTypeInfo();
+  Data::Ast::OutfixOperator::getTypeInfo();
+  Data::Ast::PrefixOperator::getTypeInfo();
+  Data::Ast::PostfixOperator::getTypeInfo();
+  Data::Ast::ParamPass::getTypeInfo();
+  Data::Ast::Passage::getTypeInfo();
+  Data::Ast::Route::getTypeInfo();
+  Data::Ast::Scope::getTypeInfo();
+  Data::Ast::Text::getTypeInfo();
+  Data::Ast::Identifier::getTypeInfo();
+  Data::Ast::IntegerLiteral::getTypeInfo();
+  Data::Ast::FloatLiteral::getTypeInfo();
+  Data::Ast::CharLiteral::getTypeInfo();
+  Data::Ast::StringLiteral::getTypeInfo();
+  Data::Ast::Token::getTypeInfo();
+}
+
+
+//==============================================================================
+// Member Functions
+
+void AstCache::setDirectory(Char const *dir)
+{
+  this->directory = S("");
+  if (dir == 0 || dir[0] == C('\0') || !AstCache::isAvailable()) return;
+
+  #ifndef WINDOWS
+    // Create the directory along with any missing parents.
+    Str path = dir;
+    if (path(path.getLength() - 1) != C('/')) path += C('/');
+    for (Int i = 1; i < static_cast<Int>(path.getLength()); ++i) {
+      if (path(i) != C('/')) continue;
+      Str parent(path, 0, i);
+      if (mkdir(parent, 0755) != 0 && errno != EEXIST) {
+        LOG(LogLevel::PARSER_MAJOR, S("Could not create AST cache directory: ") << parent.getBuf());
+        return;
+      }
+    }
+    this->directory = path;
+  #endif
+}
+
+
+Bool AstCache::load(
+  Char const *path, Char const *content, Word contentSize, Char const *signature, std::vector<Step> &steps
+) {
+  steps.clear();
+  if (!this->isEnabled()) return false;
+
+  Processing::MappedFile entry;
+  if (!entry.open(this->getEntryPath(path))) {
+    ++this->missCount;
+    return false;
+  }
+
+  Char const *pos = entry.getData();
+  Char const *end = pos + entry.getSize();
+  auto readWord = [&pos, end](LongWord &w, Word size)->Bool {
+    if (static_cast<Word>(end - pos) < size) return false;
+    w = 0;
+    memcpy(&w, pos, size);
+    pos += size;
+    return true;
+  };
+  auto matchString = [&pos, end, &readWord](Char const *str)->Bool {
+    LongWord size;
+    if (!readWord(size, 4) || static_cast<LongWord>(end - pos) < size) return false;
+    if (size != getStrLen(str) || memcmp(pos, str, size) != 0) return false;
+    pos += size;
+    return true;
+  };
+
+  auto validateHeader = [&]()->Bool {
+    LongWord version, size, hash;
+    if (static_cast<Word>(end - pos) < sizeof(entryMagic) || memcmp(pos, entryMagic, sizeof(entryMagic)) != 0) {
+      return false;
+    }
+    pos += sizeof(entryMagic);
+    if (!readWord(version, 4) || version != entryVersion) return false;
+    if (!matchString(signature) || !matchString(path)) return false;
+    if (!readWord(size, 8) || size != contentSize) return false;
+    if (!readWord(hash, 8) || hash != AstCache::computeHash(content, contentSize)) return false;
+    if (!readWord(size, 8) || !readWord(hash, 8) || static_cast<LongWord>(end - pos) != size) return false;
+    return hash == AstCache::computeHash(pos, size);
+  };
+  if (!validateHeader()) {
+    ++this->missCount;
+    return false;
+  }
+
+  try {
+    Reader reader(pos, end);
+    reader.readStrings();
+    Event event;
+    while ((event = reader.readEvent()) != AstCache::Event::END) {
+      steps.push_back(Step(event, reader.readObject()));
+    }
+  } catch (Exception &e) {
+    // Entries recorded with types that aren't available in this process are treated as missing.
+    steps.clear();
+    ++this->missCount;
+    return false;
+  }
+
+  ++this->hitCount;
+  return true;
+}
+
+
+void AstCache::store(
+  Char const *path, Char const *content, Word contentSize, Char const *signature, Recorder const &recorder
+) {
+  if (!this->isEnabled() || !recorder.isValid()) return;
+
+  std::string body;
+  auto appendWord = [](std::string &buffer, LongWord w, Word size) {
+    buffer.append(reinterpret_cast<Char const*>(&w), size);
+  };
+  appendWord(body, recorder.strings.size(), 4);
+  for (auto const &str : recorder.strings) {
+    appendWord(body, str.size(), 4);
+    body.append(str);
+  }
+  body.append(recorder.payload);
+  body.push_back(static_cast<Char>(AstCache::Event::END));
+
+  std::string header(entryMagic, sizeof(entryMagic));
+  appendWord(header, entryVersion, 4);
+  appendWord(header, getStrLen(signature), 4);
+  header.append(signature);
+  appendWord(header, getStrLen(path), 4);
+  header.append(path);
+  appendWord(header, contentSize, 8);
+  appendWord(header, AstCache::computeHash(content, contentSize), 8);
+  appendWord(header, body.size(), 8);
+  appendWord(header, AstCache::computeHash(body.data(), body.size()), 8);
+
+  #ifndef WINDOWS
+    // Write into a temporary file then rename it so concurrent runs never see partially written entries.
+    Str entryPath = this->getEntryPath(path);
+    std::array<Char,PATH_MAX> tempPath;
+    copyStr(entryPath + S(".tmp-XXXXXX"), tempPath.data());
+    int fd = mkstemp(tempPath.data());
+    if (fd == -1) return;
+    Bool written =
+      write(fd, header.data(), header.size()) == static_cast<ssize_t>(header.size()) &&
+      write(fd, body.data(), body.size()) == static_cast<ssize_t>(body.size());
+    if (close(fd) != 0) written = false;
+    if (!written || rename(tempPath.data(), entryPath) != 0) {
+      unlink(tempPath.data());
+      return;
+    }
+    ++this->storeCount;
+  #endif
+}
+
+
+Str AstCache::getEntryPath(Char const *path) const
+{
+  Char name[32];
+  snprintf(name, sizeof(name), S("%016llx.ast"), static_cast<unsigned long long>(
+    AstCache::computeHash(path, getStrLen(path))
+  ));
+  return this->directory + name;
+}
+
+
+LongWord AstCache::computeHash(Char const *buffer, Word size)
+{
+  LongWord hash = 0xcbf29ce484222325ull;
+  for (Word i = 0; i < size; ++i) {
+    hash ^= static_cast<Byte>(buffer[i]);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+
+//==============================================================================
+// Recorder
+
+void AstCache::Recorder::record(Event event, TiObject *data)
+{
+  if (!this->valid) return;
+  this->recordedObjects.clear();
+  try {
+    this->writeByte(event.val);
+    this->writeObject(data);
+  } catch (Exception &e) {
+    LOG(LogLevel::PARSER_MAJOR, S("AST can't be cached: ") << e.getVerboseErrorMessage());
+    this->invalidate();
+  }
+}
+
+
+void AstCache::Recorder::writeByte(Byte b)
+{
+  this->payload.push_back(static_cast<Char>(b));
+}
+
+
+void AstCache::Recorder::writeWord32(Word w)
+{
+  this->payload.append(reinterpret_cast<Char const*>(&w), 4);
+}
+
+
+void AstCache::Recorder::writeWord64(LongWord w)
+{
+  this->payload.append(reinterpret_cast<Char const*>(&w), 8);
+}
+
+
+void AstCache::Recorder::writeStringRef(Char const *str)
+{
+  auto result = this->stringIndexes.emplace(str, this->strings.size());
+  if (result.second) this->strings.push_back(str);
+  this->writeWord32(result.first->second);
+}
+
+
+void AstCache::Recorder::writeObject(TiObject *obj, Bool isId)
+{
+  if (obj == 0) {
+    this->writeByte(AstCache::ValueTag::NONE);
+  } else if (obj->isDerivedFrom<TiInt>()) {
+    this->writeByte(AstCache::ValueTag::INT);
+    this->writeWord64(static_cast<LongInt>(static_cast<TiInt*>(obj)->get()));
+  } else if (obj->isDerivedFrom<TiWord>()) {
+    Word value = static_cast<TiWord*>(obj)->get();
+    if (isId && ID_GENERATOR->isDefined(value)) {
+      this->writeByte(AstCache::ValueTag::ID);
+      this->writeStringRef(ID_GENERATOR->getDesc(value));
+    } else {
+      this->writeByte(AstCache::ValueTag::WORD);
+      this->writeWord64(value);
+    }
+  } else if (obj->isDerivedFrom<TiFloat>()) {
+    Float value = static_cast<TiFloat*>(obj)->get();
+    this->writeByte(AstCache::ValueTag::FLOAT);
+    this->payload.append(reinterpret_cast<Char const*>(&value), sizeof(value));
+  } else if (obj->isDerivedFrom<TiBool>()) {
+    this->writeByte(AstCache::ValueTag::BOOL);
+    this->writeByte(static_cast<TiBool*>(obj)->get() ? 1 : 0);
+  } else if (obj->isDerivedFrom<TiStr>()) {
+    Char const *value = static_cast<TiStr*>(obj)->get();
+    Word size = getStrLen(value);
+    this->writeByte(AstCache::ValueTag::STR);
+    this->writeWord32(size);
+    this->payload.append(value, size);
+  } else if (obj->isDerivedFrom<TiWStr>()) {
+    WChar const *value = static_cast<TiWStr*>(obj)->get();
+    Word size = getStrLen(value);
+    this->writeByte(AstCache::ValueTag::WSTR);
+    this->writeWord32(size);
+    for (Word i = 0; i < size; ++i) this->writeWord32(value[i]);
+  } else {
+    auto iterator = this->recordedObjects.find(obj);
+    if (iterator != this->recordedObjects.end()) {
+      this->writeByte(AstCache::ValueTag::BACK_REF);
+      this->writeWord32(iterator->second);
+      return;
+    }
+    Word index = this->recordedObjects.size();
+
+    if (obj->isA<Data::SourceLocationRecord>()) {
+      auto sourceLocation = static_cast<Data::SourceLocationRecord*>(obj);
+      this->recordedObjects[obj] = index;
+      this->writeByte(AstCache::ValueTag::SOURCE_LOCATION_RECORD);
+      this->writeStringRef(sourceLocation->filename);
+      this->writeWord32(sourceLocation->line);
+      this->writeWord32(sourceLocation->column);
+    } else if (obj->isA<Data::SourceLocationStack>()) {
+      auto stack = static_cast<Data::SourceLocationStack*>(obj);
+      this->recordedObjects[obj] = index;
+      this->writeByte(AstCache::ValueTag::SOURCE_LOCATION_STACK);
+      this->writeWord32(stack->getCount());
+      for (Int i = 0; i < stack->getCount(); ++i) this->writeObject(stack->get(i).get());
+    } else {
+      auto typeInfo = obj->getMyTypeInfo();
+      if (ti_cast<Data::Node>(obj) == 0 || typeInfo->getFactory() == 0) {
+        throw EXCEPTION(
+          InvalidArgumentException, S("obj"), S("Object type can't be cached."), typeInfo->getUniqueName()
+        );
+      }
+      this->recordedObjects[obj] = index;
+      this->writeByte(AstCache::ValueTag::OBJECT);
+      this->writeStringRef(typeInfo->getUniqueName());
+      this->writeMembers(obj);
+      this->writeElements(obj);
+    }
+  }
+}
+
+
+void AstCache::Recorder::writeMembers(TiObject *obj)
+{
+  auto binding = ti_cast<Binding>(obj);
+  if (binding != 0) {
+    for (Int i = 0; i < binding->getMemberCount(); ++i) {
+      auto key = binding->getMemberKey(i);
+      auto holdMode = binding->getMemberHoldMode(i);
+      auto member = binding->getMember(i);
+      if (member == 0) continue;
+      if (holdMode != HoldMode::VALUE && holdMode != HoldMode::SHARED_REF) {
+        throw EXCEPTION(
+          InvalidArgumentException, S("obj"), S("Members held by plain or weak references can't be cached."), key
+        );
+      }
+      if (member->isDerivedFrom<TiPtr>()) {
+        if (static_cast<TiPtr*>(member)->get() == 0) continue;
+        throw EXCEPTION(InvalidArgumentException, S("obj"), S("Pointer members can't be cached."), key);
+      }
+      // Production and token IDs depend on the order in which IDs are generated, so they are stored as descriptions.
+      Bool isId = key == S("prodId") || (obj->isDerivedFrom<Data::Ast::Token>() && key == S("id"));
+      this->writeWord32(i);
+      this->writeObject(member, isId);
+    }
+  }
+  this->writeWord32(endOfMembers);
+}
+
+
+void AstCache::Recorder::writeElements(TiObject *obj)
+{
+  DynamicMapContaining<TiObject> *dynMapContainer;
+  DynamicContaining<TiObject> *dynContainer;
+  Containing<TiObject> *container;
+  if ((dynMapContainer = ti_cast<DynamicMapContaining<TiObject>>(obj)) != 0) {
+    this->writeByte(AstCache::ElementsKind::DYNAMIC_MAP);
+    this->writeWord32(dynMapContainer->getElementCount());
+    for (Int i = 0; i < dynMapContainer->getElementCount(); ++i) {
+      auto element = dynMapContainer->getElement(i);
+      if (element != 0 && dynMapContainer->getElementHoldMode(i) != HoldMode::SHARED_REF) {
+        throw EXCEPTION(InvalidArgumentException, S("obj"), S("Elements not held by shared references can't be cached."));
+      }
+      auto key = dynMapContainer->getElementKey(i);
+      this->writeWord32(key.getLength());
+      this->payload.append(key.getBuf(), key.getLength());
+      this->writeObject(element);
+    }
+  } else if ((dynContainer = ti_cast<DynamicContaining<TiObject>>(obj)) != 0) {
+    this->writeByte(AstCache::ElementsKind::DYNAMIC_LIST);
+    this->writeWord32(dynContainer->getElementCount());
+    for (Int i = 0; i < dynContainer->getElementCount(); ++i) {
+      auto element = dynContainer->getElement(i);
+      if (element != 0 && dynContainer->getElementHoldMode(i) != HoldMode::SHARED_REF) {
+        throw EXCEPTION(InvalidArgumentException, S("obj"), S("Elements not held by shared references can't be cached."));
+      }
+      this->writeObject(element);
+    }
+  } else if ((container = ti_cast<Containing<TiObject>>(obj)) != 0) {
+    this->writeByte(AstCache::ElementsKind::FIXED);
+    for (Int i = 0; i < container->getElementCount(); ++i) {
+      auto element = container->getElement(i);
+      if (element == 0) continue;
+      if (container->getElementHoldMode(i) != HoldMode::SHARED_REF) {
+        throw EXCEPTION(InvalidArgumentException, S("obj"), S("Elements not held by shared references can't be cached."));
+      }
+      this->writeWord32(i);
+      this->writeObject(element);
+    }
+    this->writeWord32(endOfMembers);
+  } else {
+    this->writeByte(AstCache::ElementsKind::NONE);
+  }
+}
+
+
+//==============================================================================
+// Reader
+
+void AstCache::Reader::readStrings()
+{
+  Word count = this->readWord32();
+  if (count > static_cast<Word>(this->end - this->pos) / 4) {
+    throw EXCEPTION(GenericException, S("AST cache entry is truncated."));
+  }
+  this->strings.resize(count);
+  for (Word i = 0; i < count; ++i) {
+    Word size = this->readWord32();
+    if (static_cast<Word>(this->end - this->pos) < size) {
+      throw EXCEPTION(GenericException, S("AST cache entry is truncated."));
+    }
+    this->strings[i].assign(this->pos, size);
+    this->pos += size;
+  }
+}
+
+
+AstCache::Event AstCache::Reader::readEvent()
+{
+  this->objects.clear();
+  Byte event = this->readByte();
+  if (event > AstCache::Event::DUMP) {
+    throw EXCEPTION(GenericException, S("AST cache entry has an invalid event."));
+  }
+  return AstCache::Event(static_cast<AstCache::Event::_Event>(event));
+}
+
+
+TioSharedPtr AstCache::Reader::readObject()
+{
+  Byte tag = this->readByte();
+  if (tag == AstCache::ValueTag::NONE) {
+    return TioSharedPtr::null;
+  } else if (tag == AstCache::ValueTag::INT) {
+    return TiInt::create(static_cast<Int>(static_cast<LongInt>(this->readWord64())));
+  } else if (tag == AstCache::ValueTag::WORD) {
+    return TiWord::create(this->readWord64());
+  } else if (tag == AstCache::ValueTag::ID) {
+    return TiWord::create(ID_GENERATOR->getId(this->readStringRef()));
+  } else if (tag == AstCache::ValueTag::FLOAT) {
+    Float value;
+    this->readBytes(&value, sizeof(value));
+    return TiFloat::create(value);
+  } else if (tag == AstCache::ValueTag::BOOL) {
+    return TiBool::create(this->readByte() != 0);
+  } else if (tag == AstCache::ValueTag::STR) {
+    Word size = this->readWord32();
+    if (static_cast<Word>(this->end - this->pos) < size) {
+      throw EXCEPTION(GenericException, S("AST cache entry is truncated."));
+    }
+    auto str = TiStr::create(this->pos, size);
+    this->pos += size;
+    return str;
+  } else if (tag == AstCache::ValueTag::WSTR) {
+    Word size = this->readWord32();
+    if (size > static_cast<Word>(this->end - this->pos) / 4) {
+      throw EXCEPTION(GenericException, S("AST cache entry is truncated."));
+    }
+    std::vector<WChar> chars(size + 1, 0);
+    for (Word i = 0; i < size; ++i) chars[i] = this->readWord32();
+    return TiWStr::create(chars.data(), size);
+  } else if (tag == AstCache::ValueTag::BACK_REF) {
+    Word index = this->readWord32();
+    if (index >= this->objects.size()) {
+      throw EXCEPTION(GenericException, S("AST cache entry has an invalid object reference."));
+    }
+    return this->objects[index];
+  } else if (tag == AstCache::ValueTag::SOURCE_LOCATION_RECORD) {
+    auto sourceLocation = newSrdObj<Data::SourceLocationRecord>();
+    this->objects.push_back(sourceLocation);
+    sourceLocation->filename = this->readStringRef();
+    sourceLocation->line = this->readWord32();
+    sourceLocation->column = this->readWord32();
+    return sourceLocation;
+  } else if (tag == AstCache::ValueTag::SOURCE_LOCATION_STACK) {
+    auto stack = newSrdObj<Data::SourceLocationStack>();
+    this->objects.push_back(stack);
+    Word count = this->readWord32();
+    for (Word i = 0; i < count; ++i) {
+      auto sourceLocation = this->readObject().ti_cast<Data::SourceLocation>();
+      if (sourceLocation == 0) {
+        throw EXCEPTION(GenericException, S("AST cache entry has an invalid source location."));
+      }
+      stack->push(sourceLocation.get());
+    }
+    return stack;
+  } else if (tag == AstCache::ValueTag::OBJECT) {
+    auto obj = this->createNode(this->readStringRef());
+    this->objects.push_back(obj);
+    this->readMembers(obj.get());
+    this->readElements(obj.get());
+    return obj;
+  } else {
+    throw EXCEPTION(GenericException, S("AST cache entry has an invalid value."));
+  }
+}
+
+
+Byte AstCache::Reader::readByte()
+{
+  Byte b;
+  this->readBytes(&b, 1);
+  return b;
+}
+
+
+Word AstCache::Reader::readWord32()
+{
+  Word w;
+  this->readBytes(&w, 4);
+  return w;
+}
+
+
+LongWord AstCache::Reader::readWord64()
+{
+  LongWord w;
+  this->readBytes(&w, 8);
+  return w;
+}
+
+
+void AstCache::Reader::readBytes(void *buf, Word size)
+{
+  if (static_cast<Word>(this->end - this->pos) < size) {
+    throw EXCEPTION(GenericException, S("AST cache entry is truncated."));
+  }
+  memcpy(buf, this->pos, size);
+  this->pos += size;
+}
+
+
+Str const& AstCache::Reader::readStringRef()
+{
+  Word index = this->readWord32();
+  if (index >= this->strings.size()) {
+    throw EXCEPTION(GenericException, S("AST cache entry has an invalid string reference."));
+  }
+  return this->strings[index];
+}
+
+
+void AstCache::Reader::readMembers(TiObject *obj)
+{
+  auto binding = ti_cast<Binding>(obj);
+  Word index;
+  while ((index = this->readWord32()) != endOfMembers) {
+    if (binding == 0 || index >= binding->getMemberCount()) {
+      throw EXCEPTION(GenericException, S("AST cache entry has an invalid member."));
+    }
+    auto member = this->readObject();
+    auto current = binding->getMember(index);
+    // Enum members are stored as plain integers, so they are set in place.
+    if (
+      member != 0 && current != 0 && current->getMyTypeInfo() != member->getMyTypeInfo() &&
+      current->isDerivedFrom<TiInt>() && member->isA<TiInt>()
+    ) {
+      static_cast<TiInt*>(current)->set(member.s_cast_get<TiInt>()->get());
+    } else {
+      binding->setMember(index, member.get());
+    }
+  }
+}
+
+
+void AstCache::Reader::readElements(TiObject *obj)
+{
+  Byte kind = this->readByte();
+  if (kind == AstCache::ElementsKind::DYNAMIC_MAP) {
+    auto dynMapContainer = ti_cast<DynamicMapContaining<TiObject>>(obj);
+    if (dynMapContainer == 0) throw EXCEPTION(GenericException, S("AST cache entry has invalid elements."));
+    Word count = this->readWord32();
+    Str key;
+    for (Word i = 0; i < count; ++i) {
+      Word size = this->readWord32();
+      if (static_cast<Word>(this->end - this->pos) < size) {
+        throw EXCEPTION(GenericException, S("AST cache entry is truncated."));
+      }
+      key.assign(this->pos, size);
+      this->pos += size;
+      auto element = this->readObject();
+      dynMapContainer->addElement(key, element.get());
+    }
+  } else if (kind == AstCache::ElementsKind::DYNAMIC_LIST) {
+    auto dynContainer = ti_cast<DynamicContaining<TiObject>>(obj);
+    if (dynContainer == 0) throw EXCEPTION(GenericException, S("AST cache entry has invalid elements."));
+    Word count = this->readWord32();
+    for (Word i = 0; i < count; ++i) {
+      auto element = this->readObject();
+      dynContainer->addElement(element.get());
+    }
+  } else if (kind == AstCache::ElementsKind::FIXED) {
+    auto container = ti_cast<Containing<TiObject>>(obj);
+    Word index;
+    while ((index = this->readWord32()) != endOfMembers) {
+      if (container == 0 || index >= container->getElementCount()) {
+        throw EXCEPTION(GenericException, S("AST cache entry has invalid elements."));
+      }
+      auto element = this->readObject();
+      container->setElement(index, element.get());
+    }
+  } else if (kind != AstCache::ElementsKind::NONE) {
+    throw EXCEPTION(GenericException, S("AST cache entry has invalid elements."));
+  }
+}
+
+
+TioSharedPtr AstCache::Reader::createNode(Str const &typeName)
+{
+  // Types are looked up by their unique names, which only works for types whose type info was initialized.
+  auto typeInfo = reinterpret_cast<ObjectTypeInfo const*>(GLOBAL_STORAGE->getObject(typeName));
+  if (typeInfo == 0 || typeInfo->getFactory() == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("typeName"), S("AST cache entry refers to an unknown type."), typeName);
+  }
+  return typeInfo->getFactory()->createShared();
+}
+
+} // namespace
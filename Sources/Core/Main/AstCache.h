@@ -0,0 +1,233 @@
+/**
+ * @file Core/Main/AstCache.h
+ * Contains the header of class Core::Main::AstCache.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_MAIN_ASTCACHE_H
+#define CORE_MAIN_ASTCACHE_H
+
+namespace Core::Main
+{
+
+/**
+ * @brief An on-disk cache of the parsed ASTs of source files.
+ * @ingroup core_standard
+ *
+ * Parsing a source file has side effects that can't be captured by its AST
+ * alone, since imports and dumps are performed by the parser as they are
+ * encountered. An entry in the cache is therefore a recording of the events
+ * that parsing a file produced, in order: the root elements that were handed
+ * to the root scope handler, along with the import and dump commands. Loading
+ * a file from the cache replays these events instead of parsing the file.
+ *
+ * Entries are identified by the full path of the source file and are only
+ * used if the content of the file and the signature of the loading process
+ * match the ones recorded in the entry. The signature should describe
+ * everything that affects the grammar. The cache is disabled until a
+ * directory is set.
+ */
+class AstCache
+{
+  //============================================================================
+  // Types
+
+  /// The events recorded in an entry.
+  public: s_enum(Event, END, ELEMENT, IMPORT, DUMP);
+
+  /// The kind of value that follows in an entry.
+  private: s_enum(ValueTag,
+    NONE, OBJECT, BACK_REF, INT, WORD, ID, FLOAT, BOOL, STR, WSTR, SOURCE_LOCATION_RECORD, SOURCE_LOCATION_STACK
+  );
+
+  /// The way the elements of an object are stored.
+  private: s_enum(ElementsKind, NONE, DYNAMIC_MAP, DYNAMIC_LIST, FIXED);
+
+  /// A single event loaded from an entry, along with the AST it carries.
+  public: struct Step
+  {
+    Event event;
+    TioSharedPtr data;
+
+    Step(Event e, TioSharedPtr const &d) : event(e), data(d) {}
+  };
+
+  /**
+   * @brief Records the events of parsing a single file.
+   *
+   * ASTs are serialized as soon as they are recorded since the root scope
+   * handler is free to modify them afterwards. A recording that can't be
+   * stored, like one that has an AST node that can't be serialized, is
+   * invalidated instead of raising an error, so that parsing can continue
+   * normally without caching.
+   */
+  public: class Recorder
+  {
+    friend class AstCache;
+
+    private: std::string payload;
+    private: std::vector<std::string> strings;
+    private: std::unordered_map<std::string, Word> stringIndexes;
+    private: std::unordered_map<TiObject const*, Word> recordedObjects;
+    private: Bool valid = true;
+
+    public: void recordElement(TiObject *data)
+    {
+      this->record(AstCache::Event::ELEMENT, data);
+    }
+
+    public: void recordImport(TiObject *command)
+    {
+      this->record(AstCache::Event::IMPORT, command);
+    }
+
+    public: void recordDump(TiObject *command)
+    {
+      this->record(AstCache::Event::DUMP, command);
+    }
+
+    /// Mark the recording as not storable.
+    public: void invalidate()
+    {
+      this->valid = false;
+    }
+
+    public: Bool isValid() const
+    {
+      return this->valid;
+    }
+
+    private: void record(Event event, TiObject *data);
+    private: void writeByte(Byte b);
+    private: void writeWord32(Word w);
+    private: void writeWord64(LongWord w);
+    private: void writeStringRef(Char const *str);
+    private: void writeObject(TiObject *obj, Bool isId = false);
+    private: void writeMembers(TiObject *obj);
+    private: void writeElements(TiObject *obj);
+  };
+
+  /// Reads the events of a loaded entry.
+  private: class Reader
+  {
+    private: Char const *pos;
+    private: Char const *end;
+    private: std::vector<Str> strings;
+    private: std::vector<TioSharedPtr> objects;
+
+    public: Reader(Char const *p, Char const *e) : pos(p), end(e)
+    {
+    }
+
+    public: void readStrings();
+    public: Event readEvent();
+    public: TioSharedPtr readObject();
+
+    private: Byte readByte();
+    private: Word readWord32();
+    private: LongWord readWord64();
+    private: void readBytes(void *buf, Word size);
+    private: Str const& readStringRef();
+    private: void readMembers(TiObject *obj);
+    private: void readElements(TiObject *obj);
+    private: TioSharedPtr createNode(Str const &typeName);
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: Str directory;
+
+  private: Word hitCount = 0;
+  private: Word missCount = 0;
+  private: Word storeCount = 0;
+
+
+  //============================================================================
+  // Constructor
+
+  public: AstCache();
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Whether the cache is supported on this platform. Entries are written using POSIX file functions.
+  public: static Bool isAvailable()
+  {
+    #ifdef WINDOWS
+      return false;
+    #else
+      return true;
+    #endif
+  }
+
+  /**
+   * @brief Set the directory in which entries are stored, creating it if needed.
+   * An empty path, or a platform on which the cache isn't available, disables the cache.
+   */
+  public: void setDirectory(Char const *dir);
+
+  public: Str const& getDirectory() const
+  {
+    return this->directory;
+  }
+
+  public: Bool isEnabled() const
+  {
+    return this->directory.getLength() > 0;
+  }
+
+  /**
+   * @brief Load the recorded events of the given source file.
+   *
+   * All events are decoded before returning so that a corrupted entry is
+   * detected before any of its events is replayed.
+   *
+   * @param path The full path of the source file.
+   * @param content The current content of the source file.
+   * @param signature The signature of the loading process.
+   * @return Returns false if there is no valid entry for this file content
+   *         and signature.
+   */
+  public: Bool load(
+    Char const *path, Char const *content, Word contentSize, Char const *signature, std::vector<Step> &steps
+  );
+
+  /// Store the given recording as the entry of the given source file, replacing any existing entry.
+  public: void store(
+    Char const *path, Char const *content, Word contentSize, Char const *signature, Recorder const &recorder
+  );
+
+  public: Word getHitCount() const
+  {
+    return this->hitCount;
+  }
+
+  public: Word getMissCount() const
+  {
+    return this->missCount;
+  }
+
+  public: Word getStoreCount() const
+  {
+    return this->storeCount;
+  }
+
+  private: Str getEntryPath(Char const *path) const;
+
+  /// Compute the 64 bit FNV-1a hash of the given buffer.
+  private: static LongWord computeHash(Char const *buffer, Word size);
+
+}; // class
+
+} // namespace
+
+#endif
@@ -16,7 +16,7 @@
 namespace Core::Main
 {
 
-void LibraryManager::addLibrary(PtrWord id, LibraryGateway *gateway)
+void LibraryManager::addLibrary(PtrWord id, LibraryGateway *gateway, Char const *path)
 {
   for (Word i = 0; i < this->entries.size(); ++i) {
     if (this->entries[i].id == id) {
@@ -26,7 +26,7 @@ void LibraryManager::addLibrary(PtrWord id, LibraryGateway *gateway)
       return;
     }
   }
-  this->entries.push_back(Entry(id, gateway));
+  this->entries.push_back(Entry(id, gateway, path));
   if (gateway != 0) gateway->initialize(this->root);
 }
 
@@ -108,11 +108,19 @@ PtrWord LibraryManager::load(Char const *path, Str &error)
   }
 
   PtrWord id = reinterpret_cast<PtrWord>(handle);
-  this->addLibrary(id, gateway);
+  this->addLibrary(id, gateway, path);
   return id;
 }
 
 
+void LibraryManager::getGatewayPaths(std::vector<Str> &paths) const
+{
+  for (Word i = 0; i < this->entries.size(); ++i) {
+    if (this->entries[i].gateway != 0) paths.push_back(this->entries[i].path);
+  }
+}
+
+
 void LibraryManager::unload(PtrWord id)
 {
   this->removeLibrary(id);
@@ -34,8 +34,9 @@ class LibraryManager : public TiObject
     PtrWord id;
     LibraryGateway *gateway;
     Int refCount;
+    Str path;
 
-    Entry(PtrWord i, LibraryGateway *g) : id(i), gateway(g), refCount(1) {}
+    Entry(PtrWord i, LibraryGateway *g, Char const *p) : id(i), gateway(g), refCount(1), path(p) {}
   };
 
 
@@ -62,7 +63,7 @@ class LibraryManager : public TiObject
   //============================================================================
   // Member Functions
 
-  public: void addLibrary(PtrWord id, LibraryGateway *gateway);
+  public: void addLibrary(PtrWord id, LibraryGateway *gateway, Char const *path = S(""));
 
   public: void removeLibrary(PtrWord id);
 
@@ -74,6 +75,9 @@ class LibraryManager : public TiObject
 
   public: PtrWord load(Char const *path, Str &error);
 
+  /// Get the paths of the loaded libraries that have gateways, in the order in which they were loaded.
+  public: void getGatewayPaths(std::vector<Str> &paths) const;
+
   public: void unload(PtrWord id);
 
   public: void unloadAll();
@@ -47,6 +47,9 @@ RootManager::RootManager() : libraryManager(this), processedFiles(true)
   factory.createGrammar(this->exprRootScope.get(), this, true);
 
   this->interactive = false;
+  this->lexerDfaEnabled = false;
+  this->grammarCustomized = false;
+  this->jitOptimizationTimeReporting = false;
   this->processArgCount = 0;
   this->processArgs = 0;
 
@@ -76,6 +79,68 @@ RootManager::RootManager() : libraryManager(this), processedFiles(true)
 }
 
 
+//==============================================================================
+// AST Cache Functions
+
+Str RootManager::getAstCacheSignature()
+{
+  // The grammar is defined by the executable and is extended by the libraries loaded so far. The executable is
+  // identified by its size and modification time in addition to the version, since the grammar can change between
+  // builds of the same version.
+  Str signature = ALUSUS_VERSION ALUSUS_REVISION;
+  struct stat fileStat;
+  if (stat(getModulePath(), &fileStat) == 0) {
+    signature += C(';');
+    signature += static_cast<LongInt>(fileStat.st_size);
+    signature += C(';');
+    signature += static_cast<LongInt>(fileStat.st_mtime);
+  }
+  std::vector<Str> paths;
+  this->libraryManager.getGatewayPaths(paths);
+  for (auto const &path : paths) {
+    signature += C(';');
+    signature += path;
+    if (stat(path, &fileStat) == 0) {
+      signature += C(':');
+      signature += static_cast<LongInt>(fileStat.st_size);
+      signature += C(':');
+      signature += static_cast<LongInt>(fileStat.st_mtime);
+    }
+  }
+  return signature;
+}
+
+
+SharedPtr<TiObject> RootManager::replayAst(std::vector<AstCache::Step> const &steps)
+{
+  // There is no parser at this point, so the handlers get a standalone state that has the root scope as its only
+  // scope and collects the notices.
+  Processing::ParserState state;
+  state.getDataStack()->push(this->rootScope);
+  auto importHandler = newSrdObj<Processing::Handlers::ImportParsingHandler>(this);
+  auto dumpHandler = newSrdObj<Processing::Handlers::DumpAstParsingHandler>(this);
+
+  for (auto const &step : steps) {
+    if (step.event == AstCache::Event::ELEMENT) {
+      this->rootScopeHandler.addNewElement(step.data, 0, &state);
+    } else if (step.event == AstCache::Event::IMPORT) {
+      importHandler->importCommand(step.data.get(), &state);
+    } else if (step.event == AstCache::Event::DUMP) {
+      dumpHandler->dump(step.data.get(), this->rootScope.get(), &state);
+    }
+
+    Int count = state.getNoticeStore()->getCount();
+    if (count == 0) continue;
+    for (Int i = 0; i < count; ++i) {
+      this->inerNoticeSignal.emit(state.getNoticeStore()->get(i));
+    }
+    state.getNoticeStore()->flush(count);
+  }
+
+  return this->rootScope;
+}
+
+
 //==============================================================================
 // Member Functions
 
@@ -94,7 +159,13 @@ void RootManager::flushNotices()
 
 SharedPtr<TiObject> RootManager::parseExpression(Char const *str)
 {
+  // Only parsing of source files is recorded into the AST cache.
+  auto astRecorder = this->rootScopeHandler.getAstRecorder();
+  this->rootScopeHandler.setAstRecorder(0);
+  finally([=]()->void { this->rootScopeHandler.setAstRecorder(astRecorder); });
+
   Processing::Engine engine(this->exprRootScope);
+  engine.setLexerDfaEnabled(this->lexerDfaEnabled);
   auto result = engine.processString(str, str);
 
   if (result == 0) {
@@ -112,7 +183,14 @@ SharedPtr<TiObject> RootManager::parseExpression(Char const *str)
 
 SharedPtr<TiObject> RootManager::processString(Char const *str, Char const *name)
 {
+  // Code processed while a file is being parsed is generated when the file is parsed, or replayed, rather than being
+  // part of the file, so it isn't recorded.
+  auto astRecorder = this->rootScopeHandler.getAstRecorder();
+  this->rootScopeHandler.setAstRecorder(0);
+  finally([=]()->void { this->rootScopeHandler.setAstRecorder(astRecorder); });
+
   Processing::Engine engine(this->rootScope);
+  engine.setLexerDfaEnabled(this->lexerDfaEnabled);
   this->noticeSignal.relay(engine.noticeSignal);
   return engine.processString(str, name);
 }
@@ -146,10 +224,56 @@ SharedPtr<TiObject> RootManager::_processFile(Char const *fullPath, Bool allowRe
     this->pushSearchPath(searchPath);
   }
 
-  // Process the file.
-  Processing::Engine engine(this->rootScope);
-  this->noticeSignal.relay(engine.noticeSignal);
-  auto result = engine.processFile(fullPath);
+  // Get the content of the file ahead of parsing so that it can be matched against the AST cache.
+  Processing::MappedFile mappedFile;
+  Char const *content = 0;
+  Word contentSize = 0;
+  if (mappedFile.open(fullPath)) {
+    content = mappedFile.getData();
+    contentSize = mappedFile.getSize();
+  }
+
+  Bool useAstCache = content != 0 && this->astCache.isEnabled() && !this->grammarCustomized;
+  Str astCacheSignature;
+  if (useAstCache) astCacheSignature = this->getAstCacheSignature();
+  // The given path can be overwritten by nested imports, so keep a copy for storing the file's entry.
+  Str path = fullPath;
+
+  SharedPtr<TiObject> result;
+  std::vector<AstCache::Step> astSteps;
+  if (useAstCache && this->astCache.load(path, content, contentSize, astCacheSignature, astSteps)) {
+    LOG(LogLevel::PARSER_MAJOR, S("Loading source file from AST cache: ") << path.getBuf());
+    result = this->replayAst(astSteps);
+  } else {
+    AstCache::Recorder astRecorder;
+    auto prevAstRecorder = this->rootScopeHandler.getAstRecorder();
+    this->rootScopeHandler.setAstRecorder(useAstCache ? &astRecorder : 0);
+    finally([=]()->void { this->rootScopeHandler.setAstRecorder(prevAstRecorder); });
+
+    // Process the file.
+    Processing::Engine engine(this->rootScope);
+    engine.setLexerDfaEnabled(this->lexerDfaEnabled);
+    this->noticeSignal.relay(engine.noticeSignal);
+    // Notices raised by the parser aren't replayed, so files that raise any aren't cached.
+    Slot<void, SharedPtr<Notices::Notice> const&> astNoticeSlot(
+      [&astRecorder](SharedPtr<Notices::Notice> const &notice)->void
+      {
+        astRecorder.invalidate();
+      }
+    );
+    engine.noticeSignal.connect(astNoticeSlot);
+    if (content != 0) {
+      result = engine.processBuffer(content, contentSize, fullPath);
+    } else {
+      result = engine.processFile(fullPath);
+    }
+
+    // The grammar could have changed while the file was being parsed, in which case the recording can't be replayed
+    // with the grammar it started with.
+    if (useAstCache && !this->grammarCustomized && this->getAstCacheSignature() == astCacheSignature) {
+      this->astCache.store(path, content, contentSize, astCacheSignature, astRecorder);
+    }
+  }
 
   // Remove the added path, if any.
   if (searchPath.getLength() > 0) {
@@ -162,7 +286,12 @@ SharedPtr<TiObject> RootManager::_processFile(Char const *fullPath, Bool allowRe
 
 SharedPtr<TiObject> RootManager::processStream(Processing::CharInStreaming *is, Char const *streamName)
 {
+  auto astRecorder = this->rootScopeHandler.getAstRecorder();
+  this->rootScopeHandler.setAstRecorder(0);
+  finally([=]()->void { this->rootScopeHandler.setAstRecorder(astRecorder); });
+
   Processing::Engine engine(this->rootScope);
+  engine.setLexerDfaEnabled(this->lexerDfaEnabled);
   this->noticeSignal.relay(engine.noticeSignal);
   return engine.processStream(is, streamName);
 }
@@ -52,16 +52,33 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   private: Data::Seeker seeker;
 
+  private: AstCache astCache;
+
+  /// Set once the grammar is modified at run time, after which source files are no longer cached.
+  private: Bool grammarCustomized;
+
   private: Notices::Store noticeStore;
 
   private: Int minNoticeSeverityEncountered = -1;
 
   private: Bool interactive;
+  private: Bool lexerDfaEnabled;
   private: Int processArgCount;
   private: Char const *const *processArgs;
   private: Str language;
   private: Str coreBinPath;
 
+  /// The JIT optimization level requested on the command line, or empty for the default.
+  private: Str jitOptimizationLevel;
+  private: Bool jitOptimizationTimeReporting;
+
+  /// The directory of the on-disk cache of JIT compiled objects, or empty to disable caching.
+  private: Str jitCacheDirectory;
+
+  /// The profile guided optimization mode of the JIT ("generate" or "use"), or empty to disable profiling.
+  private: Str jitProfileMode;
+  private: Str jitProfileFilename;
+
 
   //============================================================================
   // Signals
@@ -126,6 +143,50 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return &this->noticeStore;
   }
 
+  /// @name AST Cache Functions
+  /// @{
+
+  /// Set the directory of the on-disk cache of parsed source files, or an empty path to disable caching.
+  public: void setAstCacheDirectory(Char const *dir)
+  {
+    this->astCache.setDirectory(dir);
+  }
+
+  public: Str const& getAstCacheDirectory() const
+  {
+    return this->astCache.getDirectory();
+  }
+
+  public: AstCache* getAstCache()
+  {
+    return &this->astCache;
+  }
+
+  /**
+   * @brief Notify the root manager that the grammar was modified at run time.
+   *
+   * Parsing of source files processed afterwards can depend on these
+   * modifications, which can't be described by the signature of the AST
+   * cache, so the cache is bypassed from this point on.
+   */
+  public: void notifyGrammarCustomized()
+  {
+    this->grammarCustomized = true;
+  }
+
+  public: Bool isGrammarCustomized() const
+  {
+    return this->grammarCustomized;
+  }
+
+  /// Get the signature that identifies AST cache entries recorded with the current grammar.
+  private: Str getAstCacheSignature();
+
+  /// Perform the events of a source file loaded from the AST cache the way the parser would have performed them.
+  private: SharedPtr<TiObject> replayAst(std::vector<AstCache::Step> const &steps);
+
+  /// @}
+
   public: void flushNotices();
 
   public: virtual SharedPtr<TiObject> parseExpression(Char const *str);
@@ -170,6 +231,16 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return this->interactive;
   }
 
+  public: void setLexerDfaEnabled(Bool enabled)
+  {
+    this->lexerDfaEnabled = enabled;
+  }
+
+  public: Bool isLexerDfaEnabled() const
+  {
+    return this->lexerDfaEnabled;
+  }
+
   public: void setProcessArgInfo(Int count, Char const *const *args)
   {
     this->processArgCount = count;
@@ -201,6 +272,65 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return this->coreBinPath;
   }
 
+  /**
+   * @brief Set the optimization level to be used by the JIT.
+   *
+   * The level is interpreted by the code generation library. The Core only
+   * passes it along.
+   */
+  public: void setJitOptimizationLevel(Char const *level)
+  {
+    this->jitOptimizationLevel = level;
+  }
+
+  public: Str const& getJitOptimizationLevel() const
+  {
+    return this->jitOptimizationLevel;
+  }
+
+  /// Set whether the time spent optimizing each JIT module should be printed.
+  public: void setJitOptimizationTimeReporting(Bool enabled)
+  {
+    this->jitOptimizationTimeReporting = enabled;
+  }
+
+  public: Bool isJitOptimizationTimeReporting() const
+  {
+    return this->jitOptimizationTimeReporting;
+  }
+
+  public: void setJitCacheDirectory(Char const *dir)
+  {
+    this->jitCacheDirectory = dir;
+  }
+
+  public: Str const& getJitCacheDirectory() const
+  {
+    return this->jitCacheDirectory;
+  }
+
+  /**
+   * @brief Set the profile guided optimization mode of the JIT.
+   *
+   * Like the optimization level, the mode is interpreted by the code
+   * generation library.
+   */
+  public: void setJitProfiling(Char const *mode, Char const *filename)
+  {
+    this->jitProfileMode = mode;
+    this->jitProfileFilename = filename;
+  }
+
+  public: Str const& getJitProfileMode() const
+  {
+    return this->jitProfileMode;
+  }
+
+  public: Str const& getJitProfileFilename() const
+  {
+    return this->jitProfileFilename;
+  }
+
 }; // class
 
 } // namespace
@@ -41,6 +41,9 @@ class RootScopeHandler : public TiObject, public DynamicBinding, public DynamicI
 
   private: SharedPtr<Data::Ast::Scope> rootScope;
 
+  /// Receives the root elements parsed from the file currently being recorded into the AST cache, if any.
+  private: AstCache::Recorder *astRecorder = 0;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -85,6 +88,16 @@ class RootScopeHandler : public TiObject, public DynamicBinding, public DynamicI
     return this->seeker;
   }
 
+  public: void setAstRecorder(AstCache::Recorder *r)
+  {
+    this->astRecorder = r;
+  }
+
+  public: AstCache::Recorder* getAstRecorder() const
+  {
+    return this->astRecorder;
+  }
+
   /// @}
 
   /// @name Main Functions
@@ -53,7 +53,7 @@ Srl::String getWorkingDirectory()
 }
 
 
-Srl::String getModuleDirectory()
+Srl::String getModulePath()
 {
   thread_local static std::array<Char,FILENAME_MAX> currentPath;
 
@@ -71,8 +71,15 @@ Srl::String getModuleDirectory()
     std::string path(currentPath.data(), (count > 0) ? count : 0);
   #endif
 
-  Int pos = path.rfind(C('/'));
-  return Srl::String(path.c_str(), pos+1);
+  return Srl::String(path.c_str());
+}
+
+
+Srl::String getModuleDirectory()
+{
+  Srl::String path = getModulePath();
+  Int pos = path.findLast(C('/'));
+  return Srl::String(path.getBuf(), pos+1);
 }
 
 } // namespace
@@ -76,6 +76,15 @@ typedef LibraryGateway* (*LibraryGatewayGetter)();
  */
 Srl::String getWorkingDirectory();
 
+/**
+ * @brief Gets the full path of the executable.
+ * @ingroup core_standard
+ *
+ * This method is used to wrap the platform-specific implementation inside a
+ * platform independent function.
+ */
+Srl::String getModulePath();
+
 /**
  * @brief Gets the directory of the executable.
  * @ingroup core_standard
@@ -95,6 +104,7 @@ Srl::String getModuleDirectory();
 
 #include "LibraryGateway.h"
 #include "LibraryManager.h"
+#include "AstCache.h"
 #include "RootScopeHandler.h"
 #include "RootManager.h"
 
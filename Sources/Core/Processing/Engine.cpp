@@ -36,6 +36,15 @@ SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
   if (str == 0) {
     throw EXCEPTION(InvalidArgumentException, S("str"), S("Cannot be null."), str);
   }
+  return this->processBuffer(str, getStrLen(str), name);
+}
+
+
+SharedPtr<TiObject> Engine::processBuffer(Char const *buffer, Word length, Char const *name)
+{
+  if (buffer == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("buffer"), S("Cannot be null."));
+  }
 
   this->parser.beginParsing();
 
@@ -45,7 +54,7 @@ SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
   sourceLocation.filename = name;
   sourceLocation.line = 1;
   sourceLocation.column = 1;
-  lexer.handleNewString(str, sourceLocation);
+  lexer.handleNewString(buffer, length, sourceLocation);
 
   auto endLine = sourceLocation.line;
   auto endColumn = sourceLocation.column;
@@ -61,6 +70,12 @@ SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
 
 SharedPtr<TiObject> Engine::processFile(Char const *filename)
 {
+  // Map the file and feed it to the lexer in bulk, unless it can't be mapped.
+  MappedFile mappedFile;
+  if (mappedFile.open(filename)) {
+    return this->processBuffer(mappedFile.getData(), mappedFile.getSize(), filename);
+  }
+
   // Open the file.
   std::ifstream fin(filename);
   StdCharInStream finStream(&fin);
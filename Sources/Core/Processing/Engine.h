@@ -63,9 +63,19 @@ class Engine : public TiObject
 
   public: void initialize(SharedPtr<Data::Ast::Scope> const &rootScope);
 
+  /// Enable or disable compiling the lexer grammar into a DFA.
+  /// @sa Lexer::setDfaEnabled
+  public: void setLexerDfaEnabled(Bool enabled)
+  {
+    this->lexer.setDfaEnabled(enabled);
+  }
+
   /// Parse the given string and return any resulting parsing data.
   public: SharedPtr<TiObject> processString(Char const *str, Char const *name);
 
+  /// Parse the given block of characters and return any resulting parsing data.
+  public: SharedPtr<TiObject> processBuffer(Char const *buffer, Word length, Char const *name);
+
   /// Parse the given file and return any resulting parsing data.
   public: SharedPtr<TiObject> processFile(Char const *filename);
 
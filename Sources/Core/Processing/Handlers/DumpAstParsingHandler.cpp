@@ -21,10 +21,35 @@ using namespace Core::Data;
 // Overloaded Abstract Functions
 
 void DumpAstParsingHandler::onProdEnd(Parser *parser, ParserState *state)
+{
+  auto recorder = this->rootManager->getRootScopeHandler()->getAstRecorder();
+  if (recorder != 0) {
+    // The dumped element is looked up from the scope of the command, so only dumps at the root scope can be
+    // replayed from the AST cache.
+    Bool atRootScope = true;
+    auto dataStack = state->getDataStack();
+    for (Int i = 0; i < dataStack->getCount(); ++i) {
+      auto scope = ti_cast<Ast::Scope>(dataStack->getElement(i));
+      if (scope != 0 && scope != parser->getRootScope().get()) atRootScope = false;
+    }
+    if (atRootScope) recorder->recordDump(state->getData().get());
+    else recorder->invalidate();
+  }
+
+  this->dump(state->getData().get(), parser->getRootScope().get(), state);
+
+  state->setData(SharedPtr<TiObject>(0));
+}
+
+
+//==============================================================================
+// Member Functions
+
+void DumpAstParsingHandler::dump(TiObject *command, Ast::Scope *rootScope, ParserState *state)
 {
   using SeekVerb = Data::Seeker::Verb;
 
-  auto data = state->getData().ti_cast_get<Containing<TiObject>>()->getElement(1);
+  auto data = ti_cast<Containing<TiObject>>(command)->getElement(1);
   ASSERT(data != 0);
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(data);
   ASSERT(metadata != 0);
@@ -35,7 +60,7 @@ void DumpAstParsingHandler::onProdEnd(Parser *parser, ParserState *state)
     if (node == 0) {
       state->addNotice(newSrdObj<Notices::InvalidDumpArgNotice>(metadata->findSourceLocation()));
     } else {
-      node->setOwner(parser->getRootScope().get());
+      node->setOwner(rootScope);
       this->rootManager->getSeeker()->foreach(data, state->getDataStack(),
         [=, &found](TiInt action, TiObject *obj)->SeekVerb
         {
@@ -55,8 +80,6 @@ void DumpAstParsingHandler::onProdEnd(Parser *parser, ParserState *state)
   } catch (InvalidArgumentException) {
     state->addNotice(newSrdObj<Notices::InvalidDumpArgNotice>(metadata->findSourceLocation()));
   }
-
-  state->setData(SharedPtr<TiObject>(0));
 }
 
 } // namespace
@@ -43,6 +43,9 @@ class DumpAstParsingHandler : public GenericParsingHandler
 
   public: virtual void onProdEnd(Parser *parser, ParserState *state);
 
+  /// Dump the element referenced by the given dump command, adding any errors to the given state.
+  public: void dump(TiObject *command, Data::Ast::Scope *rootScope, ParserState *state);
+
 }; // class
 
 } // namespace
@@ -22,23 +22,34 @@ using namespace Data;
 // Overloaded Abstract Functions
 
 void ImportParsingHandler::onProdEnd(Parser *parser, ParserState *state)
+{
+  auto recorder = this->rootManager->getRootScopeHandler()->getAstRecorder();
+  if (recorder != 0) recorder->recordImport(state->getData().get());
+  this->importCommand(state->getData().get(), state);
+  // Reset parsed data because we are done with the command.
+  state->setData(SharedPtr<TiObject>(0));
+}
+
+
+//==============================================================================
+// Member Functions
+
+void ImportParsingHandler::importCommand(TiObject *command, ParserState *state)
 {
   Str filenames;
   Str errorDetails;
   auto result = this->tryImport(
-    state->getData().ti_cast_get<Containing<TiObject>>()->getElement(1), filenames, errorDetails, state
+    ti_cast<Containing<TiObject>>(command)->getElement(1), filenames, errorDetails, state
   );
   if (result == 0) {
     // TODO: Log the loaded library in the parent statement list in order to unload it when
     //       the statement list is complete.
   } else if (result == 1) {
-    auto metadata = state->getData().ti_cast<Ast::MetaHaving>();
+    auto metadata = ti_cast<Ast::MetaHaving>(command);
     state->addNotice(newSrdObj<Notices::ImportLoadFailedNotice>(
       filenames, errorDetails, metadata->findSourceLocation()
     ));
   }
-  // Reset parsed data because we are done with the command.
-  state->setData(SharedPtr<TiObject>(0));
 }
 
 
@@ -46,6 +46,9 @@ class ImportParsingHandler : public GenericParsingHandler
   /// Load the referenced library.
   public: virtual void onProdEnd(Parser *parser, ParserState *state);
 
+  /// Import the files referenced by the given import command, adding any errors to the given state.
+  public: void importCommand(TiObject *command, ParserState *state);
+
   private: Int tryImport(TiObject *astNode, Str &filenames, Str &errorDetails, ParserState *state);
 
 }; // class
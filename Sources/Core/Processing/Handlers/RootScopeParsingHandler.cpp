@@ -25,6 +25,8 @@ void RootScopeParsingHandler::addData(
   SharedPtr<TiObject> const &data, Parser *parser, ParserState *state, Int levelIndex
 ) {
   if (state->isAProdRoot(levelIndex)) {
+    auto recorder = this->rootScopeHandler->getAstRecorder();
+    if (recorder != 0 && data != 0) recorder->recordElement(data.get());
     this->rootScopeHandler->addNewElement(data, parser, state);
   } else {
     GenericParsingHandler::addData(data, parser, state, levelIndex);
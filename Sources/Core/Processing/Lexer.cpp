@@ -72,10 +72,8 @@ void Lexer::handleNewChar(Char inputChar, Data::SourceLocationRecord &sourceLoca
   convertStr(this->tempByteCharBuffer, this->tempByteCharCount, wideCharBuffer, 1, processedIn, processedOut);
   if (processedOut != 0) {
     // Conversion was successful. Send converted character to the buffer.
-    this->pushChar(wideCharBuffer[0], sourceLocation);
-    this->processBuffer();
-    computeNextCharPosition(wideCharBuffer[0], sourceLocation.line, sourceLocation.column);
     this->tempByteCharCount = 0;
+    this->handleNewWideChar(wideCharBuffer[0], sourceLocation);
   } else if (this->tempByteCharCount == 4) {
     throw EXCEPTION(GenericException,
                     S("Invalid input character sequence. Sequence could not be converted to wide characters."));
@@ -93,12 +91,124 @@ void Lexer::handleNewChar(Char inputChar, Data::SourceLocationRecord &sourceLoca
  */
 void Lexer::handleNewString(Char const *inputStr, Data::SourceLocationRecord &sourceLocation)
 {
-  for (Int i = 0; i < static_cast<Int>(strlen(inputStr)); i++) {
-    this->handleNewChar(inputStr[i], sourceLocation);
+  this->handleNewString(inputStr, getStrLen(inputStr), sourceLocation);
+}
+
+
+/**
+ * Decode a single UTF-8 sequence.
+ *
+ * @return The length of the sequence, 0 if the available bytes are a valid
+ *         but incomplete sequence, or -1 if the sequence is invalid.
+ */
+static Int decodeUtf8Char(Byte const *input, Word available, WChar &output)
+{
+  Byte lead = input[0];
+  Int length;
+  Word code;
+  Word minCode;
+  if (lead < 0x80) {
+    output = lead;
+    return 1;
+  } else if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+    code = lead & 0x1F;
+    minCode = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    length = 3;
+    code = lead & 0x0F;
+    minCode = 0x800;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+    code = lead & 0x07;
+    minCode = 0x10000;
+  } else {
+    return -1;
+  }
+  for (Int i = 1; i < length; ++i) {
+    if (i >= available) return 0;
+    if ((input[i] & 0xC0) != 0x80) return -1;
+    code = (code << 6) | (input[i] & 0x3F);
+  }
+  if (code < minCode || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) return -1;
+  output = code;
+  return length;
+}
+
+
+/**
+ * Add a block of UTF-8 characters to the input buffer and keep processing
+ * until no more characters are in the input buffer.
+ *
+ * The block is decoded in chunks of LEXER_BULK_DECODE_SIZE characters rather
+ * than one byte at a time, with ASCII runs checked and widened eight bytes at
+ * a time. A multi byte sequence that is cut off at the end of the block is
+ * kept until the following call, similar to handleNewChar.
+ *
+ * @param inputStr The characters to add to the input buffer. This doesn't
+ *                 need to be null terminated.
+ * @param length The number of bytes in inputStr.
+ * @param sourceLocation The source location of the first character in the
+ *                       block. This will be updated with the new location.
+ */
+void Lexer::handleNewString(Char const *inputStr, Word length, Data::SourceLocationRecord &sourceLocation)
+{
+  Byte const *input = reinterpret_cast<Byte const*>(inputStr);
+  Word i = 0;
+
+  // Complete any sequence left incomplete by a previous call.
+  while (this->tempByteCharCount > 0 && i < length) this->handleNewChar(inputStr[i++], sourceLocation);
+
+  WChar buffer[LEXER_BULK_DECODE_SIZE];
+  while (i < length) {
+    Word count = 0;
+    Bool incomplete = false;
+    Bool invalid = false;
+    while (count < LEXER_BULK_DECODE_SIZE && i < length) {
+      while (count + 8 <= LEXER_BULK_DECODE_SIZE && i + 8 <= length) {
+        LongWord bytes;
+        memcpy(&bytes, input + i, 8);
+        if ((bytes & 0x8080808080808080ul) != 0) break;
+        for (Int j = 0; j < 8; ++j) buffer[count + j] = input[i + j];
+        count += 8;
+        i += 8;
+      }
+      if (count == LEXER_BULK_DECODE_SIZE || i == length) break;
+      Int sequenceLength = decodeUtf8Char(input + i, length - i, buffer[count]);
+      if (sequenceLength > 0) {
+        ++count;
+        i += sequenceLength;
+      } else {
+        if (sequenceLength == 0) incomplete = true;
+        else invalid = true;
+        break;
+      }
+    }
+
+    for (Word j = 0; j < count; ++j) this->handleNewWideChar(buffer[j], sourceLocation);
+
+    if (invalid) {
+      throw EXCEPTION(GenericException,
+                      S("Invalid input character sequence. Sequence could not be converted to wide characters."));
+    } else if (incomplete) {
+      while (i < length) this->handleNewChar(inputStr[i++], sourceLocation);
+    }
   }
 }
 
 
+/**
+ * Add a single decoded character to the input buffer and keep processing
+ * until no more characters are in the input buffer.
+ */
+void Lexer::handleNewWideChar(WChar inputChar, Data::SourceLocationRecord &sourceLocation)
+{
+  this->pushChar(inputChar, sourceLocation);
+  this->processBuffer();
+  computeNextCharPosition(inputChar, sourceLocation.line, sourceLocation.column);
+}
+
+
 /**
  * Keep processing the input buffer until it has no more input characters.
  */
@@ -219,9 +329,12 @@ Int Lexer::process()
 
   // Check if this is the first character.
   if (this->currentProcessingIndex == 0) {
-    this->processStartChar(inputChar);
+    this->prepareDfa();
+    if (this->dfa != 0) this->processDfaStartChar(inputChar);
+    else this->processStartChar(inputChar);
   } else {
-    this->processNextChar(inputChar);
+    if (this->dfa != 0) this->processDfaNextChar(inputChar);
+    else this->processNextChar(inputChar);
   }
 
   auto tempStates = this->states;
@@ -586,6 +699,109 @@ void Lexer::processNextChar(WChar inputChar)
 }
 
 
+/**
+ * Makes sure the compiled DFA of the current grammar is used for the next token
+ * if DFA compilation is enabled. The DFA is compiled on first use and cached
+ * in the lexer module, which drops it when the grammar is modified, so this is
+ * checked at the start of each token. If the grammar can't be compiled the
+ * lexer keeps interpreting it.
+ */
+void Lexer::prepareDfa()
+{
+  if (!this->dfaEnabled) {
+    this->dfa.reset();
+    return;
+  }
+  auto lexerModule = static_cast<Core::Data::Grammar::LexerModule*>(this->grammarContext.getModule());
+  if (!lexerModule->isDfaCompilationAttempted()) {
+    auto compiledDfa = LexerDfa::compile(&this->grammarContext);
+    lexerModule->setCompiledDfa(compiledDfa);
+    if (compiledDfa != 0) {
+      LOG(LogLevel::LEXER_MAJOR, S("Compiled lexer DFA. States: ") << compiledDfa->getStateCount()
+          << S(", Char classes: ") << compiledDfa->getCharClassCount());
+    } else {
+      LOG(LogLevel::LEXER_MAJOR, S("Couldn't compile lexer DFA. Interpreting the grammar instead."));
+    }
+  }
+  this->dfa = lexerModule->getCompiledDfa().s_cast<LexerDfa>();
+}
+
+
+/**
+ * Processes the first character in the token using the compiled DFA. A single
+ * open state is created to represent all candidate tokens, with its DFA state
+ * kept in dfaState. This state isn't associated with a specific token
+ * definition.
+ *
+ * @param inputChar The input character to search against.
+ */
+void Lexer::processDfaStartChar(WChar inputChar)
+{
+  // There must not be any state currently in the stack.
+  ASSERT(this->stateCount == 0);
+
+  LOG(LogLevel::LEXER_MID, S("Starting a new token using DFA. New char: '") << inputChar << S("'"));
+
+  this->dfaState = this->dfa->getNextState(this->dfa->getStartState(), inputChar);
+  if (this->dfaState != -1) {
+    auto state = this->createState();
+    state->setTokenDefIndex(-1);
+    state->setTokenLength(0);
+    this->nextStates[this->nextStateCount++] = state;
+  }
+}
+
+
+/**
+ * Processes the next character in the token using the compiled DFA. If the DFA
+ * state reached so far accepts a token, a closed state is created for that
+ * token before moving the open state to the next DFA state. Closed states are
+ * then handled by process the same way it handles closed states produced by
+ * interpreting the grammar.
+ *
+ * @param inputChar The next input character received from the input stream.
+ */
+void Lexer::processDfaNextChar(WChar inputChar)
+{
+  // There must be some states currently in the stack.
+  ASSERT(this->stateCount != 0);
+
+  LOG(LogLevel::LEXER_MID, S("Processing new character using DFA: '") << inputChar << S("'"));
+
+  while (this->stateCount > 0) {
+    auto state = this->states[--this->stateCount];
+    if (state->getTokenLength() > 0) {
+      this->nextStates[this->nextStateCount++] = state;
+      continue;
+    }
+    // The characters so far might form a full token.
+    Int defIndex = this->dfa->getAcceptedDefIndex(this->dfaState);
+    if (defIndex != -1) {
+      auto closedState = this->createState();
+      closedState->setTokenDefIndex(defIndex);
+      closedState->setTokenLength(this->currentProcessingIndex);
+      this->nextStates[this->nextStateCount++] = closedState;
+    }
+    // Move on to the next DFA state.
+    this->dfaState = this->dfa->getNextState(this->dfaState, inputChar);
+    if (this->dfaState != -1) {
+      this->nextStates[this->nextStateCount++] = state;
+    } else {
+      this->recycledStates[this->recycledStateCount++] = state;
+    }
+  }
+
+  #ifdef USE_LOGS
+    for (Int i = 0; i < static_cast<Int>(this->nextStateCount); ++i) {
+      if (this->nextStates[i]->getTokenLength() == 0) continue;
+      Int index = this->nextStates[i]->getTokenDefIndex();
+      Int id = this->getSymbolDefinition(index)->getId();
+      LOG(LogLevel::LEXER_MID, S("Closed Token: ") << ID_GENERATOR->getDesc(id));
+    }
+  #endif
+}
+
+
 /**
  * Apply the given input character on the temp state object creating new state
  * objects if necessary. This recursive function is the core of the state
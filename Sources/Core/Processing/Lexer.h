@@ -80,6 +80,15 @@ class Lexer : public TiObject
   private: LexerState **recycledStates = 0;
   private: Word recycledStateCount = 0;
 
+  /// Whether to use a DFA compiled from the grammar instead of interpreting the grammar, when possible.
+  private: Bool dfaEnabled = false;
+
+  /// The DFA used for the current token, or null if the grammar is being interpreted.
+  private: SharedPtr<LexerDfa> dfa;
+
+  /// The DFA state of the current open state, if any.
+  private: Int dfaState = -1;
+
   /**
    * @brief A temporary buffer used to buffer byte characters for conversion.
    * This buffer is used to buffer the received byte characters when multi
@@ -187,11 +196,30 @@ class Lexer : public TiObject
   public: void release()
   {
     this->clear();
+    this->dfa.reset();
     this->grammarRoot.reset();
     this->grammarContext.setRoot(0);
     this->grammarContext.setModule(0);
   }
 
+  /**
+   * @brief Enable or disable compiling the grammar into a DFA.
+   *
+   * When enabled, the lexer compiles the root tokens of the lexer module into
+   * a DFA instead of interpreting the term trees for every character. The
+   * compiled DFA is cached on the lexer module until the grammar is modified.
+   * Grammars that can't be compiled are still interpreted.
+   */
+  public: void setDfaEnabled(Bool enabled)
+  {
+    this->dfaEnabled = enabled;
+  }
+
+  public: Bool isDfaEnabled() const
+  {
+    return this->dfaEnabled;
+  }
+
   /// @}
 
   /// @name Parsing Operations
@@ -200,9 +228,15 @@ class Lexer : public TiObject
   /// Add a single input character to the input buffer and process it.
   public: void handleNewChar(Char inputChar, Data::SourceLocationRecord &sourceLocation);
 
-  /// Add a string of input characters to the input buffer and process them.
+  /// Add a null terminated string of input characters to the input buffer and process them.
   public: void handleNewString(Char const *inputStr, Data::SourceLocationRecord &sourceLocation);
 
+  /// Add a block of input characters to the input buffer and process them.
+  public: void handleNewString(Char const *inputStr, Word length, Data::SourceLocationRecord &sourceLocation);
+
+  /// Add a single decoded character to the input buffer and process it.
+  private: void handleNewWideChar(WChar inputChar, Data::SourceLocationRecord &sourceLocation);
+
   /// Process all the characters currently waiting in the input buffer.
   private: void processBuffer();
 
@@ -218,6 +252,15 @@ class Lexer : public TiObject
   /// Process the next character in the token.
   private: void processNextChar(WChar inputChar);
 
+  /// Fetch or compile the DFA to be used for the next token, if enabled.
+  private: void prepareDfa();
+
+  /// Process the first character in the token using the compiled DFA.
+  private: void processDfaStartChar(WChar inputChar);
+
+  /// Process the next character in the token using the compiled DFA.
+  private: void processDfaNextChar(WChar inputChar);
+
   /// Recursively apply the given character on the temp state.
   private: NextAction processState(LexerState *state, WChar inputChar, Int minLevel = 0);
 
@@ -0,0 +1,468 @@
+/**
+ * @file Core/Processing/LexerDfa.cpp
+ * Contains the implementation of class Core::Processing::LexerDfa.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core::Processing
+{
+
+//==============================================================================
+// Compilation Functions
+
+SharedPtr<LexerDfa> LexerDfa::compile(Data::Grammar::Context *grammarContext)
+{
+  VALIDATE_NOT_NULL(grammarContext);
+  auto lexerModule = ti_cast<Data::Grammar::LexerModule>(grammarContext->getModule());
+  if (lexerModule == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("grammarContext"), S("Context's module is not a lexer module."));
+  }
+
+  // Tracing references can modify the context, so we'll work on a copy.
+  Data::Grammar::Context context;
+  context.copyFrom(grammarContext);
+
+  // Build an NFA that has a branch for each root token.
+  Nfa nfa;
+  Int nfaStart = LexerDfa::addNfaNode(nfa, -1);
+  std::vector<Bool> constDefs(lexerModule->getCount(), false);
+  std::vector<Bool> preferShorterDefs(lexerModule->getCount(), false);
+  try {
+    for (Word i = 0; i < lexerModule->getCount(); ++i) {
+      TiObject *obj = lexerModule->getElement(i);
+      if (obj == 0 || !obj->isA<Data::Grammar::SymbolDefinition>()) continue;
+      auto def = static_cast<Data::Grammar::SymbolDefinition*>(obj);
+      TiInt *flags = context.getSymbolFlags(def);
+      Int flagsValue = flags == 0 ? 0 : flags->get();
+      if (!(flagsValue & Data::Grammar::SymbolFlags::ROOT_TOKEN)) continue;
+      if (def->getTerm() == 0) return SharedPtr<LexerDfa>::null;
+      constDefs[i] = def->getTerm()->isA<Data::Grammar::ConstTerm>();
+      preferShorterDefs[i] = (flagsValue & Data::Grammar::SymbolFlags::PREFER_SHORTER) != 0;
+
+      Int entry = LexerDfa::addNfaNode(nfa, i);
+      Int exit = LexerDfa::addNfaNode(nfa, i);
+      nfa.nodes[exit].accepting = true;
+      nfa.nodes[nfaStart].epsilons.push_back(entry);
+      nfa.expansionStack.clear();
+      nfa.expansionStack.push_back(def);
+      if (!LexerDfa::buildTerm(&context, nfa, def->getTerm().get(), i, entry, exit)) {
+        return SharedPtr<LexerDfa>::null;
+      }
+    }
+  } catch (Exception &e) {
+    // Invalid grammars are left for the interpreter to report.
+    return SharedPtr<LexerDfa>::null;
+  }
+
+  auto dfa = newSrdObj<LexerDfa>();
+
+  // Compress the characters into classes.
+  std::vector<std::vector<Int>> rangeSetClasses;
+  dfa->buildCharClasses(nfa, rangeSetClasses);
+  Word classCount = dfa->classStarts.size();
+
+  // Convert the NFA into a DFA using subset construction.
+  std::vector<Word> marks(nfa.nodes.size(), 0);
+  Word stamp = 0;
+  std::map<std::vector<Int>, Int> subsetIds;
+  std::vector<std::vector<Int>> subsets;
+  std::vector<std::vector<Int>> moves(classCount);
+
+  std::vector<Int> startSubset = { nfaStart };
+  LexerDfa::computeClosure(nfa, startSubset, marks, stamp);
+  subsetIds[startSubset] = 0;
+  subsets.push_back(startSubset);
+
+  for (Word s = 0; s < subsets.size(); ++s) {
+    // Determine the accepted token using the same rules used by Lexer::selectBestToken.
+    Int acceptedDefIndex = -1;
+    for (auto node : subsets[s]) {
+      if (!nfa.nodes[node].accepting) continue;
+      Int defIndex = nfa.nodes[node].defIndex;
+      if (
+        acceptedDefIndex == -1 ||
+        (constDefs[defIndex] && !constDefs[acceptedDefIndex]) ||
+        (constDefs[defIndex] == constDefs[acceptedDefIndex] && defIndex < acceptedDefIndex)
+      ) {
+        acceptedDefIndex = defIndex;
+      }
+    }
+    // Empty tokens can't be matched by the lexer.
+    if (s == 0 && acceptedDefIndex != -1) return SharedPtr<LexerDfa>::null;
+    dfa->acceptedDefIndexes.push_back(acceptedDefIndex);
+
+    // Tokens that prefer the shorter match don't continue after being accepted.
+    Int droppedDefIndex = -1;
+    if (acceptedDefIndex != -1 && preferShorterDefs[acceptedDefIndex]) droppedDefIndex = acceptedDefIndex;
+
+    // Compute the moves of this subset.
+    for (Word c = 0; c < classCount; ++c) moves[c].clear();
+    for (auto node : subsets[s]) {
+      if (nfa.nodes[node].defIndex == droppedDefIndex) continue;
+      for (auto const &edge : nfa.nodes[node].edges) {
+        for (auto c : rangeSetClasses[edge.rangesIndex]) moves[c].push_back(edge.target);
+      }
+    }
+    for (Word c = 0; c < classCount; ++c) {
+      Int target = -1;
+      if (!moves[c].empty()) {
+        LexerDfa::computeClosure(nfa, moves[c], marks, stamp);
+        auto iter = subsetIds.find(moves[c]);
+        if (iter == subsetIds.end()) {
+          if (subsets.size() >= LEXER_DFA_MAX_STATES) return SharedPtr<LexerDfa>::null;
+          target = subsets.size();
+          subsetIds[moves[c]] = target;
+          subsets.push_back(moves[c]);
+        } else {
+          target = iter->second;
+        }
+      }
+      dfa->transitions.push_back(target);
+    }
+  }
+
+  dfa->startState = 0;
+  dfa->minimize(classCount);
+  return dfa;
+}
+
+
+Bool LexerDfa::buildTerm(
+  Data::Grammar::Context *context, Nfa &nfa, Data::Grammar::Term *term, Int defIndex, Int entry, Int exit
+) {
+  if (term == 0 || nfa.nodes.size() >= LEXER_DFA_MAX_NFA_NODES) return false;
+
+  if (term->isA<Data::Grammar::ConstTerm>()) {
+    auto constTerm = static_cast<Data::Grammar::ConstTerm*>(term);
+    auto const &matchString = constTerm->getMatchString();
+    if (matchString.getLength() == 0) return false;
+    Int current = entry;
+    for (Int i = 0; i < matchString.getLength(); ++i) {
+      Int next = i == matchString.getLength() - 1 ? exit : LexerDfa::addNfaNode(nfa, defIndex);
+      Word ch = static_cast<Word>(matchString(i));
+      nfa.rangeSets.push_back({ { ch, ch } });
+      nfa.nodes[current].edges.push_back({ static_cast<Int>(nfa.rangeSets.size() - 1), next });
+      current = next;
+    }
+    return true;
+  } else if (term->isA<Data::Grammar::CharGroupTerm>()) {
+    auto charGroupTerm = static_cast<Data::Grammar::CharGroupTerm*>(term);
+    Data::Grammar::Reference *ref = charGroupTerm->getCharGroupReference().get();
+    if (ref == 0) return false;
+    auto charGroupDef = context->getReferencedCharGroup(ref);
+    auto unit = charGroupDef->getCharGroupUnit().get();
+    if (unit == 0) return false;
+    Int rangesIndex;
+    auto iter = nfa.charGroupRangeSets.find(unit);
+    if (iter == nfa.charGroupRangeSets.end()) {
+      CharRanges ranges;
+      if (!LexerDfa::buildCharRanges(unit, ranges)) return false;
+      nfa.rangeSets.push_back(ranges);
+      rangesIndex = nfa.rangeSets.size() - 1;
+      nfa.charGroupRangeSets[unit] = rangesIndex;
+    } else {
+      rangesIndex = iter->second;
+    }
+    nfa.nodes[entry].edges.push_back({ rangesIndex, exit });
+    return true;
+  } else if (term->isA<Data::Grammar::MultiplyTerm>()) {
+    auto multiplyTerm = static_cast<Data::Grammar::MultiplyTerm*>(term);
+    auto innerTerm = multiplyTerm->getTerm().ti_cast_get<Data::Grammar::Term>();
+    if (innerTerm == 0) return false;
+    Int min = 0;
+    Int max = 0;
+    if (multiplyTerm->getMin() != 0) {
+      auto minObj = context->getMultiplyTermMin(multiplyTerm);
+      if (minObj == 0) return false;
+      min = minObj->get();
+    }
+    if (multiplyTerm->getMax() != 0) {
+      auto maxObj = context->getMultiplyTermMax(multiplyTerm);
+      if (maxObj == 0) return false;
+      max = maxObj->get();
+    }
+    // Expand the iterations the same way the interpreter walks them: each iteration can either go into the inner
+    // term or leave the multiply term, depending on the min and max values. Once the min is reached with no max,
+    // the remaining iterations are identical, so they are folded into a loop.
+    Int current = LexerDfa::addNfaNode(nfa, defIndex);
+    nfa.nodes[entry].epsilons.push_back(current);
+    for (Int i = 0; ; ++i) {
+      Bool tryInner = multiplyTerm->getMax() == 0 || max > i;
+      Bool tryOuter = multiplyTerm->getMin() == 0 || min <= i;
+      if (tryOuter) nfa.nodes[current].epsilons.push_back(exit);
+      if (!tryInner) break;
+      if (multiplyTerm->getMax() == 0 && tryOuter) {
+        return LexerDfa::buildTerm(context, nfa, innerTerm, defIndex, current, current);
+      }
+      if (nfa.nodes.size() >= LEXER_DFA_MAX_NFA_NODES) return false;
+      Int next = LexerDfa::addNfaNode(nfa, defIndex);
+      if (!LexerDfa::buildTerm(context, nfa, innerTerm, defIndex, current, next)) return false;
+      current = next;
+    }
+    return true;
+  } else if (term->isA<Data::Grammar::AlternateTerm>()) {
+    auto alternateTerm = static_cast<Data::Grammar::AlternateTerm*>(term);
+    auto alternateList = alternateTerm->getTerms().ti_cast_get<Data::Grammar::List>();
+    if (alternateList == 0 || alternateList->getCount() < 2) return false;
+    for (Int i = 0; i < alternateList->getCount(); ++i) {
+      auto branchTerm = ti_cast<Data::Grammar::Term>(alternateList->getElement(i));
+      if (branchTerm == 0) return false;
+      Int branchEntry = LexerDfa::addNfaNode(nfa, defIndex);
+      Int branchExit = LexerDfa::addNfaNode(nfa, defIndex);
+      nfa.nodes[entry].epsilons.push_back(branchEntry);
+      nfa.nodes[branchExit].epsilons.push_back(exit);
+      if (!LexerDfa::buildTerm(context, nfa, branchTerm, defIndex, branchEntry, branchExit)) return false;
+    }
+    return true;
+  } else if (term->isA<Data::Grammar::ConcatTerm>()) {
+    auto concatTerm = static_cast<Data::Grammar::ConcatTerm*>(term);
+    auto concatList = concatTerm->getTerms().ti_cast_get<Data::Grammar::List>();
+    if (concatList == 0 || concatList->getCount() == 0) return false;
+    Int current = entry;
+    for (Int i = 0; i < concatList->getCount(); ++i) {
+      auto childTerm = ti_cast<Data::Grammar::Term>(concatList->getElement(i));
+      if (childTerm == 0) return false;
+      Int next = i == concatList->getCount() - 1 ? exit : LexerDfa::addNfaNode(nfa, defIndex);
+      if (!LexerDfa::buildTerm(context, nfa, childTerm, defIndex, current, next)) return false;
+      current = next;
+    }
+    return true;
+  } else if (term->isA<Data::Grammar::ReferenceTerm>()) {
+    auto referenceTerm = static_cast<Data::Grammar::ReferenceTerm*>(term);
+    Data::Grammar::Reference *ref = referenceTerm->getReference().get();
+    if (ref == 0) return false;
+    auto lexerModule = context->getModule();
+    auto def = context->getReferencedSymbol(ref);
+    context->setModule(lexerModule);
+    if (def->findOwner<Data::Grammar::Module>() != lexerModule || def->getTerm() == 0) return false;
+    // Recursive token definitions aren't regular, so they can't be compiled into a DFA.
+    for (auto expandedDef : nfa.expansionStack) {
+      if (expandedDef == def) return false;
+    }
+    nfa.expansionStack.push_back(def);
+    Int innerEntry = LexerDfa::addNfaNode(nfa, defIndex);
+    Int innerExit = LexerDfa::addNfaNode(nfa, defIndex);
+    nfa.nodes[entry].epsilons.push_back(innerEntry);
+    nfa.nodes[innerExit].epsilons.push_back(exit);
+    if (!LexerDfa::buildTerm(context, nfa, def->getTerm().get(), defIndex, innerEntry, innerExit)) return false;
+    nfa.expansionStack.pop_back();
+    return true;
+  } else {
+    return false;
+  }
+}
+
+
+Bool LexerDfa::buildCharRanges(Data::Grammar::CharGroupUnit *unit, CharRanges &ranges)
+{
+  ASSERT(unit != 0);
+  CharRanges rawRanges;
+
+  if (unit->isA<Data::Grammar::SequenceCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::SequenceCharGroupUnit*>(unit);
+    if (u->getStartCode() == 0 && u->getEndCode() == 0) return false;
+    // Negative codes can never be produced by the input decoding, so they are dropped.
+    WChar startCode = u->getStartCode() < 0 ? 0 : u->getStartCode();
+    if (startCode <= u->getEndCode()) {
+      rawRanges.push_back({ static_cast<Word>(startCode), static_cast<Word>(u->getEndCode()) });
+    }
+  } else if (unit->isA<Data::Grammar::RandomCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::RandomCharGroupUnit*>(unit);
+    if (u->getCharList() == 0) return false;
+    for (Int i = 0; i < u->getCharListSize(); ++i) {
+      Word ch = static_cast<Word>(u->getCharList()[i]);
+      rawRanges.push_back({ ch, ch });
+    }
+  } else if (unit->isA<Data::Grammar::UnionCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::UnionCharGroupUnit*>(unit);
+    if (u->getCharGroupUnits()->size() == 0) return false;
+    for (Int i = 0; i < static_cast<Int>(u->getCharGroupUnits()->size()); ++i) {
+      auto childUnit = u->getCharGroupUnits()->at(i).get();
+      if (childUnit == 0 || !LexerDfa::buildCharRanges(childUnit, rawRanges)) return false;
+    }
+  } else if (unit->isA<Data::Grammar::InvertCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::InvertCharGroupUnit*>(unit);
+    auto childUnit = u->getChildCharGroupUnit().get();
+    if (childUnit == 0) return false;
+    CharRanges excludedRanges;
+    if (!LexerDfa::buildCharRanges(childUnit, excludedRanges)) return false;
+    Word next = 0;
+    for (auto const &range : excludedRanges) {
+      if (range.first > next) rawRanges.push_back({ next, range.first - 1 });
+      if (range.second >= LEXER_DFA_MAX_CHAR_CODE) {
+        next = LEXER_DFA_MAX_CHAR_CODE;
+        break;
+      }
+      if (range.second + 1 > next) next = range.second + 1;
+    }
+    if (next < LEXER_DFA_MAX_CHAR_CODE) rawRanges.push_back({ next, LEXER_DFA_MAX_CHAR_CODE });
+  } else {
+    return false;
+  }
+
+  // Add to the given ranges, then sort and merge them.
+  rawRanges.insert(rawRanges.end(), ranges.begin(), ranges.end());
+  std::sort(rawRanges.begin(), rawRanges.end());
+  ranges.clear();
+  for (auto const &range : rawRanges) {
+    if (!ranges.empty() && range.first <= ranges.back().second + 1) {
+      if (range.second > ranges.back().second) ranges.back().second = range.second;
+    } else {
+      ranges.push_back(range);
+    }
+  }
+  return true;
+}
+
+
+Int LexerDfa::addNfaNode(Nfa &nfa, Int defIndex)
+{
+  nfa.nodes.push_back({ defIndex, false, {}, {} });
+  return nfa.nodes.size() - 1;
+}
+
+
+/**
+ * Expands the given set of NFA nodes with all nodes reachable through epsilon
+ * moves. The resulting list is sorted so that it can be used as a key for the
+ * DFA state.
+ */
+void LexerDfa::computeClosure(Nfa const &nfa, std::vector<Int> &nodes, std::vector<Word> &marks, Word &stamp)
+{
+  ++stamp;
+  std::vector<Int> pending;
+  Word count = 0;
+  for (auto node : nodes) {
+    if (marks[node] == stamp) continue;
+    marks[node] = stamp;
+    nodes[count++] = node;
+    pending.push_back(node);
+  }
+  nodes.resize(count);
+  while (!pending.empty()) {
+    Int node = pending.back();
+    pending.pop_back();
+    for (auto target : nfa.nodes[node].epsilons) {
+      if (marks[target] == stamp) continue;
+      marks[target] = stamp;
+      nodes.push_back(target);
+      pending.push_back(target);
+    }
+  }
+  std::sort(nodes.begin(), nodes.end());
+}
+
+
+/**
+ * Splits the character space into classes such that all characters in a class
+ * are treated the same way by every edge in the NFA, then maps each range set
+ * used by the NFA into the list of classes it covers.
+ */
+void LexerDfa::buildCharClasses(Nfa const &nfa, std::vector<std::vector<Int>> &rangeSetClasses)
+{
+  this->classStarts.clear();
+  this->classStarts.push_back(0);
+  for (auto const &ranges : nfa.rangeSets) {
+    for (auto const &range : ranges) {
+      this->classStarts.push_back(range.first);
+      if (range.second < LEXER_DFA_MAX_CHAR_CODE) this->classStarts.push_back(range.second + 1);
+    }
+  }
+  std::sort(this->classStarts.begin(), this->classStarts.end());
+  this->classStarts.erase(
+    std::unique(this->classStarts.begin(), this->classStarts.end()), this->classStarts.end()
+  );
+
+  for (Word ch = 0; ch < 128; ++ch) {
+    auto iter = std::upper_bound(this->classStarts.begin(), this->classStarts.end(), ch);
+    this->asciiClasses[ch] = static_cast<Int>(iter - this->classStarts.begin()) - 1;
+  }
+
+  rangeSetClasses.resize(nfa.rangeSets.size());
+  for (Word i = 0; i < nfa.rangeSets.size(); ++i) {
+    for (auto const &range : nfa.rangeSets[i]) {
+      auto iter = std::lower_bound(this->classStarts.begin(), this->classStarts.end(), range.first);
+      for (; iter != this->classStarts.end() && *iter <= range.second; ++iter) {
+        rangeSetClasses[i].push_back(iter - this->classStarts.begin());
+      }
+    }
+  }
+}
+
+
+/**
+ * Merges equivalent states by repeatedly splitting the states into groups
+ * based on the accepted token and the groups of the target states until the
+ * groups stop changing.
+ */
+void LexerDfa::minimize(Word classCount)
+{
+  Word stateCount = this->acceptedDefIndexes.size();
+
+  // Initial partitioning is based on the accepted token.
+  std::vector<Int> groups(stateCount);
+  Word groupCount = 0;
+  {
+    std::map<Int, Int> acceptGroups;
+    for (Word s = 0; s < stateCount; ++s) {
+      auto iter = acceptGroups.find(this->acceptedDefIndexes[s]);
+      if (iter == acceptGroups.end()) {
+        acceptGroups[this->acceptedDefIndexes[s]] = groupCount;
+        groups[s] = groupCount++;
+      } else {
+        groups[s] = iter->second;
+      }
+    }
+  }
+
+  // Keep refining until stable.
+  std::vector<Int> signature(classCount + 1);
+  while (true) {
+    std::map<std::vector<Int>, Int> signatureGroups;
+    std::vector<Int> newGroups(stateCount);
+    for (Word s = 0; s < stateCount; ++s) {
+      signature[0] = groups[s];
+      for (Word c = 0; c < classCount; ++c) {
+        Int target = this->transitions[s * classCount + c];
+        signature[c + 1] = target == -1 ? -1 : groups[target];
+      }
+      auto iter = signatureGroups.find(signature);
+      if (iter == signatureGroups.end()) {
+        Int group = signatureGroups.size();
+        signatureGroups[signature] = group;
+        newGroups[s] = group;
+      } else {
+        newGroups[s] = iter->second;
+      }
+    }
+    Word newGroupCount = signatureGroups.size();
+    groups.swap(newGroups);
+    if (newGroupCount == groupCount) break;
+    groupCount = newGroupCount;
+  }
+
+  // Rebuild the tables using the groups as the new states.
+  std::vector<Int> newTransitions(groupCount * classCount);
+  std::vector<Int> newAcceptedDefIndexes(groupCount);
+  for (Word s = 0; s < stateCount; ++s) {
+    Int group = groups[s];
+    newAcceptedDefIndexes[group] = this->acceptedDefIndexes[s];
+    for (Word c = 0; c < classCount; ++c) {
+      Int target = this->transitions[s * classCount + c];
+      newTransitions[group * classCount + c] = target == -1 ? -1 : groups[target];
+    }
+  }
+  this->transitions.swap(newTransitions);
+  this->acceptedDefIndexes.swap(newAcceptedDefIndexes);
+  this->startState = groups[this->startState];
+}
+
+} // namespace
@@ -0,0 +1,189 @@
+/**
+ * @file Core/Processing/LexerDfa.h
+ * Contains the header of class Core::Processing::LexerDfa.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_PROCESSING_LEXERDFA_H
+#define CORE_PROCESSING_LEXERDFA_H
+
+namespace Core::Processing
+{
+
+/**
+ * @brief A table driven DFA compiled from the token definitions of a lexer module.
+ * @ingroup core_processing
+ *
+ * The DFA is an alternative to interpreting the term trees of token definitions
+ * character by character. It's produced by converting the root tokens of a
+ * lexer module into an NFA, converting that NFA into a DFA using subset
+ * construction, then minimizing the result. Input characters are first mapped
+ * into character classes (ranges of characters that are never distinguished by
+ * any term in the grammar) to keep the transition table compact regardless of
+ * the Unicode ranges used by char groups.<br>
+ * Each DFA state records the index of the token definition that is accepted at
+ * that state, if any, after applying the same selection rules used by the
+ * interpreter (constant tokens first, then the earlier definition). States
+ * accepting a PREFER_SHORTER token don't carry on with that token.<br>
+ * Not every grammar can be compiled; recursive token definitions, references to
+ * other modules, or grammars that produce too many states are rejected, in
+ * which case the lexer falls back to interpreting the grammar.
+ */
+class LexerDfa : public TiObject
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(LexerDfa, TiObject, "Core.Processing", "Core", "alusus.org");
+
+
+  //============================================================================
+  // Types
+
+  private: typedef std::vector<std::pair<Word, Word>> CharRanges;
+
+  private: struct NfaEdge
+  {
+    Int rangesIndex;
+    Int target;
+  };
+
+  private: struct NfaNode
+  {
+    Int defIndex;
+    Bool accepting;
+    std::vector<Int> epsilons;
+    std::vector<NfaEdge> edges;
+  };
+
+  private: struct Nfa
+  {
+    std::vector<NfaNode> nodes;
+    std::vector<CharRanges> rangeSets;
+    std::unordered_map<Data::Grammar::CharGroupUnit*, Int> charGroupRangeSets;
+    std::vector<Data::Grammar::SymbolDefinition*> expansionStack;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /// The first character of each character class, sorted in ascending order.
+  private: std::vector<Word> classStarts;
+
+  /// Direct character to class mapping for ASCII characters.
+  private: Int asciiClasses[128];
+
+  /// The transitions table, indexed by state * classCount + class. -1 means no transition.
+  private: std::vector<Int> transitions;
+
+  /// The index of the accepted token definition for each state, or -1 if the state doesn't accept.
+  private: std::vector<Int> acceptedDefIndexes;
+
+  private: Int startState = 0;
+
+
+  //============================================================================
+  // Constructor / Destructor
+
+  public: LexerDfa()
+  {
+  }
+
+  public: virtual ~LexerDfa()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// @name Compilation Functions
+  /// @{
+
+  /**
+   * @brief Compile the root tokens of the given context's lexer module.
+   *
+   * @param context A grammar context whose module is set to the lexer module.
+   * @return The compiled DFA, or null if the grammar can't be compiled into a
+   *         DFA, in which case the caller should interpret the grammar instead.
+   */
+  public: static SharedPtr<LexerDfa> compile(Data::Grammar::Context *context);
+
+  private: static Bool buildTerm(
+    Data::Grammar::Context *context, Nfa &nfa, Data::Grammar::Term *term, Int defIndex, Int entry, Int exit
+  );
+
+  private: static Bool buildCharRanges(
+    Data::Grammar::CharGroupUnit *unit, CharRanges &ranges
+  );
+
+  private: static Int addNfaNode(Nfa &nfa, Int defIndex);
+
+  private: static void computeClosure(
+    Nfa const &nfa, std::vector<Int> &nodes, std::vector<Word> &marks, Word &stamp
+  );
+
+  private: void buildCharClasses(Nfa const &nfa, std::vector<std::vector<Int>> &rangeSetClasses);
+
+  private: void minimize(Word classCount);
+
+  /// @}
+
+  /// @name Matching Functions
+  /// @{
+
+  public: Int getStartState() const
+  {
+    return this->startState;
+  }
+
+  /// Get the class of the given character.
+  public: Int getCharClass(WChar ch) const
+  {
+    Word code = static_cast<Word>(ch);
+    if (code < 128) return this->asciiClasses[code];
+    auto iter = std::upper_bound(this->classStarts.begin(), this->classStarts.end(), code);
+    return static_cast<Int>(iter - this->classStarts.begin()) - 1;
+  }
+
+  /**
+   * @brief Get the state that follows the given state after the given character.
+   * @return The next state, or -1 if the character isn't accepted by any token.
+   */
+  public: Int getNextState(Int state, WChar ch) const
+  {
+    ASSERT(state >= 0);
+    return this->transitions[state * this->classStarts.size() + this->getCharClass(ch)];
+  }
+
+  /// Get the index of the token definition accepted at the given state, or -1 if none.
+  public: Int getAcceptedDefIndex(Int state) const
+  {
+    ASSERT(state >= 0);
+    return this->acceptedDefIndexes[state];
+  }
+
+  public: Word getStateCount() const
+  {
+    return this->acceptedDefIndexes.size();
+  }
+
+  public: Word getCharClassCount() const
+  {
+    return this->classStarts.size();
+  }
+
+  /// @}
+
+}; // class
+
+} // namespace
+
+#endif
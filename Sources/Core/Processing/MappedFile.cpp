@@ -0,0 +1,109 @@
+/**
+ * @file Core/Processing/MappedFile.cpp
+ * Contains the implementation of class Core::Processing::MappedFile.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+#ifdef WINDOWS
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace Core::Processing
+{
+
+//==============================================================================
+// Member Functions
+
+Bool MappedFile::open(Char const *filename)
+{
+  this->close();
+
+  #ifdef WINDOWS
+  HANDLE file = CreateFileA(
+    filename, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0
+  );
+  if (file == INVALID_HANDLE_VALUE) return false;
+  LARGE_INTEGER fileSize;
+  if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &fileSize)) {
+    CloseHandle(file);
+    return false;
+  }
+
+  // Empty files can't be mapped, but there is nothing to map anyway.
+  if (fileSize.QuadPart == 0) {
+    CloseHandle(file);
+    this->data = S("");
+    this->size = 0;
+    this->mapped = true;
+    return true;
+  }
+
+  // The view keeps its own reference to the mapping, so both handles can be closed right away.
+  HANDLE mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+  CloseHandle(file);
+  if (mapping == 0) return false;
+  void *addr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (addr == 0) return false;
+
+  this->data = static_cast<Char const*>(addr);
+  this->size = fileSize.QuadPart;
+  this->mapped = true;
+  return true;
+  #else
+  int fd = ::open(filename, O_RDONLY);
+  if (fd == -1) return false;
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+    ::close(fd);
+    return false;
+  }
+
+  // Empty files can't be mapped, but there is nothing to map anyway.
+  if (fileStat.st_size == 0) {
+    ::close(fd);
+    this->data = S("");
+    this->size = 0;
+    this->mapped = true;
+    return true;
+  }
+
+  void *addr = mmap(0, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) return false;
+  madvise(addr, fileStat.st_size, MADV_SEQUENTIAL);
+
+  this->data = static_cast<Char const*>(addr);
+  this->size = fileStat.st_size;
+  this->mapped = true;
+  return true;
+  #endif
+}
+
+
+void MappedFile::close()
+{
+  if (!this->mapped) return;
+  #ifdef WINDOWS
+    if (this->size > 0) UnmapViewOfFile(this->data);
+  #else
+    if (this->size > 0) munmap(const_cast<Char*>(this->data), this->size);
+  #endif
+  this->data = 0;
+  this->size = 0;
+  this->mapped = false;
+}
+
+} // namespace
@@ -0,0 +1,82 @@
+/**
+ * @file Core/Processing/MappedFile.h
+ * Contains the header of class Core::Processing::MappedFile.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_PROCESSING_MAPPEDFILE_H
+#define CORE_PROCESSING_MAPPEDFILE_H
+
+namespace Core::Processing
+{
+
+/**
+ * @brief A read only memory mapping of a source file.
+ * @ingroup core_processing
+ *
+ * Maps the entire content of a file into memory so that it can be fed to the
+ * lexer in bulk without copying it first. Mapping fails for files that can't
+ * be mapped, like pipes, in which case the caller should fall back to reading
+ * the file as a stream.
+ */
+class MappedFile
+{
+  //============================================================================
+  // Member Variables
+
+  private: Char const *data = 0;
+  private: Word size = 0;
+  private: Bool mapped = false;
+
+
+  //============================================================================
+  // Constructor & Destructor
+
+  public: MappedFile()
+  {
+  }
+
+  public: MappedFile(MappedFile const&) = delete;
+
+  public: ~MappedFile()
+  {
+    this->close();
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Map the given file, returning false if it couldn't be opened or mapped.
+  public: Bool open(Char const *filename);
+
+  /// Unmap the file, if any.
+  public: void close();
+
+  public: Bool isOpen() const
+  {
+    return this->mapped;
+  }
+
+  /// Get the content of the file. The content is not null terminated.
+  public: Char const* getData() const
+  {
+    return this->data;
+  }
+
+  public: Word getSize() const
+  {
+    return this->size;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -83,6 +83,36 @@ namespace Core::Processing
  */
 #define LEXER_ERROR_BUFFER_MAX_CHARACTERS 80
 
+/**
+ * @brief The maximum number of NFA nodes used while compiling the lexer DFA.
+ * @ingroup core_processing
+ *
+ * Grammars that need more nodes than this are interpreted instead of being
+ * compiled into a DFA.
+ */
+#define LEXER_DFA_MAX_NFA_NODES 200000
+
+/**
+ * @brief The maximum number of states in the lexer DFA before minimization.
+ * @ingroup core_processing
+ *
+ * Grammars that need more states than this are interpreted instead of being
+ * compiled into a DFA.
+ */
+#define LEXER_DFA_MAX_STATES 50000
+
+/**
+ * @brief The highest character code considered by the lexer DFA.
+ * @ingroup core_processing
+ */
+#define LEXER_DFA_MAX_CHAR_CODE static_cast<Word>(WCHAR_MAX)
+
+/**
+ * @brief The number of characters decoded at once when feeding strings to the lexer.
+ * @ingroup core_processing
+ */
+#define LEXER_BULK_DECODE_SIZE 4096
+
 /**
  * @brief Compute the next position based on the given character.
  * @ingroup core_processing
@@ -230,6 +260,7 @@ s_enum(ParsingFlags,
 // Lexer
 #include "InputBuffer.h"
 #include "LexerState.h"
+#include "LexerDfa.h"
 #include "TokenizingHandler.h"
 #include "Lexer.h"
 
@@ -245,6 +276,7 @@ s_enum(ParsingFlags,
 #include "CharInStreaming.h"
 #include "StdCharInStream.h"
 #include "InteractiveCharInStream.h"
+#include "MappedFile.h"
 
 // Main Class
 #include "Engine.h"
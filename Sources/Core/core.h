@@ -16,7 +16,11 @@
 #include <array>
 #include <vector>
 #include <list>
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <algorithm>
 #include <utility>
 #include <string>
 #include <iostream>
@@ -24,6 +28,7 @@
 #include <string.h>
 #include <type_traits>
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <limits.h>
 
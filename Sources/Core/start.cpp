@@ -52,6 +52,13 @@ int main(int argCount, char * const args[])
   Bool interactive = false;
   Char const *sourceFile = 0;
   Bool dump = false;
+  Bool lexerDfa = false;
+  Char const *jitOptLevel = 0;
+  Bool jitOptReport = false;
+  Char const *jitCacheDir = getenv(S("ALUSUS_JIT_CACHE"));
+  Char const *astCacheDir = getenv(S("ALUSUS_AST_CACHE"));
+  Char const *jitProfileMode = 0;
+  Char const *jitProfileFile = 0;
   if (argCount < 2) help = true;
   for (Int i = 1; i < argCount; ++i) {
     if (strcmp(args[i], S("--help")) == 0) help = true;
@@ -62,6 +69,58 @@ int main(int argCount, char * const args[])
     else if (strcmp(args[i], S("-ت")) == 0) interactive = true;
     else if (strcmp(args[i], S("--dump")) == 0) dump = true;
     else if (strcmp(args[i], S("--إلقاء")) == 0) dump = true;
+    else if (strcmp(args[i], S("--lexer-dfa")) == 0) lexerDfa = true;
+    else if (strcmp(args[i], S("--مرمز-مترجم")) == 0) lexerDfa = true;
+    else if (strcmp(args[i], S("--jit-opt")) == 0 || strcmp(args[i], S("--تحسين-التنفيذ")) == 0) {
+      if (i < argCount-1) {
+        ++i;
+        jitOptLevel = args[i];
+      }
+      if (
+        jitOptLevel == 0 || (
+          strcmp(jitOptLevel, S("O0")) != 0 && strcmp(jitOptLevel, S("O1")) != 0 &&
+          strcmp(jitOptLevel, S("O2")) != 0 && strcmp(jitOptLevel, S("O3")) != 0 &&
+          strcmp(jitOptLevel, S("Os")) != 0 && strcmp(jitOptLevel, S("tiered")) != 0
+        )
+      ) {
+        outStream << S("Invalid JIT optimization level. Expected one of: O0, O1, O2, O3, Os, tiered.\n");
+        return EXIT_FAILURE;
+      }
+    }
+    else if (strcmp(args[i], S("--jit-opt-report")) == 0) jitOptReport = true;
+    else if (strcmp(args[i], S("--تقرير-التحسين")) == 0) jitOptReport = true;
+    else if (strcmp(args[i], S("--jit-cache")) == 0 || strcmp(args[i], S("--ذاكرة-التنفيذ")) == 0) {
+      if (i < argCount-1) {
+        ++i;
+        jitCacheDir = args[i];
+      } else {
+        outStream << S("Missing JIT cache directory.\n");
+        return EXIT_FAILURE;
+      }
+    }
+    else if (strcmp(args[i], S("--ast-cache")) == 0 || strcmp(args[i], S("--ذاكرة-الشجرة")) == 0) {
+      if (i < argCount-1) {
+        ++i;
+        astCacheDir = args[i];
+      } else {
+        outStream << S("Missing AST cache directory.\n");
+        return EXIT_FAILURE;
+      }
+    }
+    else if (
+      strcmp(args[i], S("--profile-generate")) == 0 || strcmp(args[i], S("--توليد-التشخيص")) == 0 ||
+      strcmp(args[i], S("--profile-use")) == 0 || strcmp(args[i], S("--استخدام-التشخيص")) == 0
+    ) {
+      Bool generate = strcmp(args[i], S("--profile-generate")) == 0 || strcmp(args[i], S("--توليد-التشخيص")) == 0;
+      if (i < argCount-1) {
+        ++i;
+        jitProfileMode = generate ? S("generate") : S("use");
+        jitProfileFile = args[i];
+      } else {
+        outStream << S("Missing profile filename.\n");
+        return EXIT_FAILURE;
+      }
+    }
 #ifdef USE_LOGS
     // Parse the log option.
     else if (strcmp(args[i], S("--log")) == 0 || strcmp(args[i], S("--تدوين")) == 0) {
@@ -118,6 +177,27 @@ int main(int argCount, char * const args[])
       outStream << S("\tالقاء شجرة AST عند الانتهاء:\n");
       outStream << S("\t\t--شجرة\n");
       outStream << S("\t\t--dump\n");
+      outStream << S("\tترجمة قواعد الترميز إلى آلة حالات محددة بدل تفسيرها:\n");
+      outStream << S("\t\t--مرمز-مترجم\n");
+      outStream << S("\t\t--lexer-dfa\n");
+      outStream << S("\tمستوى تحسين الشفرة المنفذة آنيا (O0، O1، O2، O3، Os، tiered):\n");
+      outStream << S("\t\t--تحسين-التنفيذ <المستوى>\n");
+      outStream << S("\t\t--jit-opt <level>\n");
+      outStream << S("\tطباعة الوقت المستغرق في تحسين كل وحدة منفذة آنيا:\n");
+      outStream << S("\t\t--تقرير-التحسين\n");
+      outStream << S("\t\t--jit-opt-report\n");
+      outStream << S("\tحفظ الشفرة المترجمة آنيا في مجلد لإعادة استخدامها في المرات التالية:\n");
+      outStream << S("\t\t--ذاكرة-التنفيذ <المجلد>\n");
+      outStream << S("\t\t--jit-cache <dir>\n");
+      outStream << S("\tحفظ شجرة AST للملفات المصدرية في مجلد لتجنب إعادة تحليلها في المرات التالية (غير متوفر على ويندوز):\n");
+      outStream << S("\t\t--ذاكرة-الشجرة <المجلد>\n");
+      outStream << S("\t\t--ast-cache <dir>\n");
+      outStream << S("\tإضافة عدادات للشفرة المنفذة آنيا وكتابة قيمها في ملف التشخيص عند انتهاء التنفيذ:\n");
+      outStream << S("\t\t--توليد-التشخيص <الملف>\n");
+      outStream << S("\t\t--profile-generate <file>\n");
+      outStream << S("\tتحسين الشفرة المنفذة آنيا باستخدام ملف تشخيص مولد سابقا:\n");
+      outStream << S("\t\t--استخدام-التشخيص <الملف>\n");
+      outStream << S("\t\t--profile-use <file>\n");
       #if defined(USE_LOGS)
         outStream << S("\tالتحكم بمستوى التدوين (قيمة من 6 بتات):\n");
         outStream << S("\t\t--تدوين\n");
@@ -138,6 +218,18 @@ int main(int argCount, char * const args[])
       outStream << S("\nOptions:\n");
       outStream << S("\t--interactive, -i  Run in interactive mode.\n");
       outStream << S("\t--dump  Tells the Core to dump the resulting AST tree.\n");
+      outStream << S("\t--lexer-dfa  Compile the lexer grammar into a DFA instead of interpreting it.\n");
+      outStream << S("\t--jit-opt <level>  The optimization level of JIT compiled code: O0, O1, O2, O3 (default), Os, or\n"
+                     "\t\ttiered.\n");
+      outStream << S("\t--jit-opt-report  Print the time spent optimizing each JIT compiled module.\n");
+      outStream << S("\t--jit-cache <dir>  Cache JIT compiled machine code in the given directory and reuse it in later\n"
+                     "\t\truns. Defaults to the value of ALUSUS_JIT_CACHE env var, if set.\n");
+      outStream << S("\t--ast-cache <dir>  Cache the parsed ASTs of source files in the given directory and reuse them\n"
+                     "\t\tin later runs instead of parsing the files again. Defaults to the value of ALUSUS_AST_CACHE\n"
+                     "\t\tenv var, if set. Not available on Windows.\n");
+      outStream << S("\t--profile-generate <file>  Instrument JIT compiled code and append the collected counters to the\n"
+                     "\t\tgiven profile file when the program exits.\n");
+      outStream << S("\t--profile-use <file>  Optimize JIT compiled code using the given profile file.\n");
       #if defined(USE_LOGS)
         outStream << S("\t--log  A 6 bit value to control the level of details of the log.\n");
       #endif
@@ -157,6 +249,12 @@ int main(int argCount, char * const args[])
       // Prepare the root object;
       Main::RootManager root;
       root.setInteractive(true);
+      root.setLexerDfaEnabled(lexerDfa);
+      if (jitOptLevel != 0) root.setJitOptimizationLevel(jitOptLevel);
+      root.setJitOptimizationTimeReporting(jitOptReport);
+      if (jitCacheDir != 0) root.setJitCacheDirectory(jitCacheDir);
+      if (astCacheDir != 0) root.setAstCacheDirectory(astCacheDir);
+      if (jitProfileMode != 0) root.setJitProfiling(jitProfileMode, jitProfileFile);
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
@@ -182,6 +280,12 @@ int main(int argCount, char * const args[])
     try {
       // Prepare the root object;
       Main::RootManager root;
+      root.setLexerDfaEnabled(lexerDfa);
+      if (jitOptLevel != 0) root.setJitOptimizationLevel(jitOptLevel);
+      root.setJitOptimizationTimeReporting(jitOptReport);
+      if (jitCacheDir != 0) root.setJitCacheDirectory(jitCacheDir);
+      if (astCacheDir != 0) root.setAstCacheDirectory(astCacheDir);
+      if (jitProfileMode != 0) root.setJitProfiling(jitProfileMode, jitProfileFile);
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
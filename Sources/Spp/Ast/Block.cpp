@@ -36,6 +36,45 @@ void Block::onRemoved(Int index)
   Scope::onRemoved(index);
 }
 
+void Block::onDefinitionsChanged()
+{
+  // Find the function body enclosing this block, if any. Blocks within types and modules can be seen from outside.
+  Block *body = this;
+  for (auto node = this->getOwner(); node != 0; node = node->getOwner()) {
+    if (node->isDerivedFrom<Function>()) {
+      if (static_cast<Function*>(node)->getBody().get() == body) {
+        ++body->localGeneration;
+        return;
+      }
+      break;
+    } else if (node->isDerivedFrom<Type>() || node->isDerivedFrom<Module>()) {
+      break;
+    } else if (node->isDerivedFrom<Block>()) {
+      body = static_cast<Block*>(node);
+    }
+  }
+  Scope::onDefinitionsChanged();
+}
+
+
+//==============================================================================
+// Generation Functions
+
+Word Block::getLocalGenerationSum(TiObject *node)
+{
+  Word sum = 0;
+  auto current = ti_cast<Core::Data::Node>(node);
+  while (current != 0) {
+    auto owner = current->getOwner();
+    if (owner != 0 && owner->isDerivedFrom<Function>() && current->isDerivedFrom<Block>()) {
+      auto block = static_cast<Block*>(current);
+      if (static_cast<Function*>(owner)->getBody().get() == block) sum += block->localGeneration;
+    }
+    current = owner;
+  }
+  return sum;
+}
+
 
 //==============================================================================
 // Injection Retrieval Functions
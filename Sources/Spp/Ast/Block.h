@@ -30,6 +30,15 @@ class Block : public Core::Data::Ast::Scope
 
   private: SubsetIndex injectionsIndex;
 
+  /**
+   * @brief Incremented whenever the definitions of this function body, or of
+   * any block nested in it, change.
+   * Only used when this block is the body of a function. Local definitions
+   * are only visible to lookups within the function, so they don't need to
+   * advance the global scopes generation.
+   */
+  private: Word localGeneration = 0;
+
 
   //============================================================================
   // Implementations
@@ -59,6 +68,27 @@ class Block : public Core::Data::Ast::Scope
 
   protected: virtual void onRemoved(Int index);
 
+  protected: virtual void onDefinitionsChanged();
+
+  /// @}
+
+  /// @name Generation Functions
+  /// @{
+
+  /// Get the number of changes to the local definitions of this function body.
+  public: Word getLocalGeneration() const
+  {
+    return this->localGeneration;
+  }
+
+  /**
+   * @brief Get the sum of the local generations of all function bodies
+   *        enclosing the given node.
+   * The sum changes whenever the local definitions visible from the node
+   * change.
+   */
+  public: static Word getLocalGenerationSum(TiObject *node);
+
   /// @}
 
   /// @name Injections Retrieval Functions
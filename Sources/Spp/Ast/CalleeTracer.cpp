@@ -15,6 +15,15 @@
 namespace Spp::Ast
 {
 
+//==============================================================================
+// Static Variables
+
+Word CalleeTracer::lookupCount = 0;
+Word CalleeTracer::lookupHitCount = 0;
+LongWord CalleeTracer::lookupTime = 0;
+Int CalleeTracer::lookupDepth = 0;
+
+
 //==============================================================================
 // Initialization Functions
 
@@ -60,6 +69,42 @@ void CalleeTracer::initBindings()
 void CalleeTracer::_lookupCallee(TiObject *self, CalleeLookupRequest &request, CalleeLookupResult &result)
 {
   PREPARE_SELF(tracer, CalleeTracer);
+  LookupTimer timer;
+  ++CalleeTracer::lookupCount;
+
+  // A lookup that starts with a previous result is affected by that result, so only fresh lookups are cached.
+  CacheKey key;
+  if (!result.isNew() || !CalleeTracer::prepareCacheKey(request, key)) {
+    tracer->traceCallee(request, result);
+    return;
+  }
+
+  tracer->syncCache();
+  auto iter = tracer->cache.find(key);
+  if (iter != tracer->cache.end()) {
+    if (iter->second.localGeneration == Block::getLocalGenerationSum(key.target)) {
+      ++CalleeTracer::lookupHitCount;
+      result = iter->second.result;
+      return;
+    }
+    tracer->cache.erase(iter);
+  }
+
+  tracer->traceCallee(request, result);
+
+  // Failures aren't cached since their notices carry the source location of the request. The lookup itself might
+  // have changed some scopes (by instantiating templates, for example), so we need to sync again before storing.
+  if (result.isSuccessful()) {
+    tracer->syncCache();
+    auto localGeneration = Block::getLocalGenerationSum(key.target);
+    tracer->cache.emplace(std::move(key), CacheEntry{ result, localGeneration });
+  }
+}
+
+
+void CalleeTracer::traceCallee(CalleeLookupRequest &request, CalleeLookupResult &result)
+{
+  auto tracer = this;
 
   if (request.ref != 0) {
     auto target = request.target;
@@ -857,4 +902,63 @@ Bool CalleeTracer::isAssignOp(Str const &op)
   return false;
 }
 
+
+Bool CalleeTracer::prepareCacheKey(CalleeLookupRequest const &request, CacheKey &key)
+{
+  // Template params are AST expressions that are only meaningful at their call site.
+  if (request.templateParam != 0) return false;
+
+  if (request.ref != 0) {
+    auto identifier = ti_cast<Core::Data::Ast::Identifier>(request.ref);
+    if (identifier == 0) return false;
+    // Bridge references are resolved differently since the lookup skips the bridge they belong to.
+    if (ti_cast<Core::Data::Ast::Bridge>(identifier->getOwner()) != 0) return false;
+    key.hasRef = true;
+    key.name = identifier->getValue().getStr();
+  } else {
+    key.hasRef = false;
+  }
+
+  key.target = request.target;
+  key.mode = request.mode;
+  key.skipInjections = request.skipInjections;
+  key.hasVarTargetOp = request.varTargetOp != 0;
+  if (request.varTargetOp != 0) key.varTargetOp = request.varTargetOp;
+  key.op = request.op;
+  key.thisType = request.thisType;
+  key.hasArgTypes = request.argTypes != 0;
+  if (request.argTypes != 0) {
+    key.argTypes.reserve(request.argTypes->getElementCount());
+    for (Int i = 0; i < request.argTypes->getElementCount(); ++i) {
+      key.argTypes.push_back(request.argTypes->getElement(i));
+    }
+  }
+  return true;
+}
+
+
+void CalleeTracer::syncCache()
+{
+  auto generation = Core::Data::Ast::Scope::getGeneration();
+  if (this->cacheGeneration != generation) {
+    this->cache.clear();
+    this->cacheGeneration = generation;
+  }
+}
+
+
+Word CalleeTracer::CacheKeyHasher::operator()(CacheKey const &key) const
+{
+  Word hash = std::hash<Str>()(key.name);
+  auto combine = [&hash](Word value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+  combine(std::hash<TiObject*>()(key.target));
+  combine(key.mode.val);
+  combine(std::hash<Str>()(key.op));
+  combine(std::hash<TiObject*>()(key.thisType));
+  for (auto argType : key.argTypes) combine(std::hash<TiObject*>()(argType));
+  return hash;
+}
+
 } // namespace
@@ -27,11 +27,95 @@ class CalleeTracer : public TiObject, public DynamicBinding, public DynamicInter
   ));
 
 
+  //============================================================================
+  // Types
+
+  /**
+   * @brief The parameters of a lookup that determine its result.
+   * The callee name is used instead of the reference node itself since call
+   * sites referring to the same name in the same scope resolve identically.
+   */
+  private: struct CacheKey
+  {
+    Bool hasRef;
+    Str name;
+    TiObject *target;
+    CalleeLookupMode mode;
+    Bool skipInjections;
+    Bool hasVarTargetOp;
+    Str varTargetOp;
+    Str op;
+    TiObject *thisType;
+    Bool hasArgTypes;
+    std::vector<TiObject*> argTypes;
+
+    Bool operator==(CacheKey const &key) const
+    {
+      return this->hasRef == key.hasRef && this->name == key.name && this->target == key.target &&
+        this->mode == key.mode && this->skipInjections == key.skipInjections &&
+        this->hasVarTargetOp == key.hasVarTargetOp && this->varTargetOp == key.varTargetOp && this->op == key.op &&
+        this->thisType == key.thisType && this->hasArgTypes == key.hasArgTypes && this->argTypes == key.argTypes;
+    }
+  };
+
+  private: struct CacheKeyHasher
+  {
+    Word operator()(CacheKey const &key) const;
+  };
+
+  /// A cached result along with the local definitions generation it was looked up at.
+  private: struct CacheEntry
+  {
+    CalleeLookupResult result;
+    Word localGeneration;
+  };
+
+  /// Records the time spent in the outermost lookup in which it is created.
+  private: class LookupTimer
+  {
+    private: Bool outermost;
+    private: std::chrono::steady_clock::time_point startTime;
+
+    public: LookupTimer()
+    {
+      this->outermost = CalleeTracer::lookupDepth++ == 0;
+      if (this->outermost) this->startTime = std::chrono::steady_clock::now();
+    }
+
+    public: ~LookupTimer()
+    {
+      --CalleeTracer::lookupDepth;
+      if (this->outermost) {
+        CalleeTracer::lookupTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - this->startTime
+        ).count();
+      }
+    }
+  };
+
+
   //============================================================================
   // Member Variables
 
   private: Helper *helper;
 
+  /**
+   * @brief The results of previous successful lookups.
+   * Any change to the definitions of scopes can change the result of a lookup,
+   * so the cache is cleared whenever the scopes generation changes. Changes to
+   * the local definitions of function bodies don't advance that generation,
+   * so each entry also records the local generations of the function bodies
+   * enclosing its target and is dropped when they no longer match.
+   */
+  private: std::unordered_map<CacheKey, CacheEntry, CacheKeyHasher> cache;
+  private: Word cacheGeneration = 0;
+
+  /// Statistics of lookups across all tracers.
+  private: static Word lookupCount;
+  private: static Word lookupHitCount;
+  private: static LongWord lookupTime;
+  private: static Int lookupDepth;
+
 
   //============================================================================
   // Implementations
@@ -93,6 +177,9 @@ class CalleeTracer : public TiObject, public DynamicBinding, public DynamicInter
   );
   private: static void _lookupCallee(TiObject *self, CalleeLookupRequest &request, CalleeLookupResult &result);
 
+  /// Perform the lookup without consulting the cache.
+  private: void traceCallee(CalleeLookupRequest &request, CalleeLookupResult &result);
+
   public: METHOD_BINDING_CACHE(lookupCallee_routing,
     void, (CalleeLookupRequest& /* request */, CalleeLookupResult& /* result */)
   );
@@ -157,6 +244,35 @@ class CalleeTracer : public TiObject, public DynamicBinding, public DynamicInter
 
   private: static Bool isAssignOp(Str const &op);
 
+  /// Fill the cache key of the given request, or return false if the request's result can't be cached.
+  private: static Bool prepareCacheKey(CalleeLookupRequest const &request, CacheKey &key);
+
+  /// Clear the cache if any scope has changed since the cache was filled.
+  private: void syncCache();
+
+  /// @}
+
+  /// @name Statistics Functions
+  /// @{
+
+  /// Get the number of lookups across all tracers, including nested ones.
+  public: static Word getLookupCount()
+  {
+    return CalleeTracer::lookupCount;
+  }
+
+  /// Get the number of lookups that were served from the cache.
+  public: static Word getLookupHitCount()
+  {
+    return CalleeTracer::lookupHitCount;
+  }
+
+  /// Get the total time, in microseconds, spent in outermost lookups.
+  public: static LongWord getLookupTime()
+  {
+    return CalleeTracer::lookupTime / 1000;
+  }
+
   /// @}
 
 }; // class
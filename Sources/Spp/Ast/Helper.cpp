@@ -92,6 +92,45 @@ void Helper::initBindings()
 }
 
 
+//==============================================================================
+// Primitive Types
+
+void Helper::onRootScopeChanged(SharedListBase<TiObject, Core::Data::Node> *scope, ContentChangeOp op, Int index)
+{
+  if (op == ContentChangeOp::REMOVED) {
+    // The removed element can no longer be inspected, so we don't know whether it was one of the primitive templates.
+    this->clearPrimitiveTypes();
+    return;
+  }
+  auto def = ti_cast<Core::Data::Ast::Definition>(scope->getElement(index));
+  if (def == 0) return;
+  auto const &name = def->getName();
+  if (name == S("Int") || name == S("Word") || name == S("Float") || name == S("array")) {
+    this->clearPrimitiveTypes();
+  }
+}
+
+
+void Helper::clearPrimitiveTypes()
+{
+  this->primitiveTypes.clear();
+  this->boolType = 0;
+  this->charType = 0;
+  this->archIntType = 0;
+  this->word64Type = 0;
+}
+
+
+void Helper::addPrimitiveType(PrimitiveTypeKind kind, Word size, Type *type)
+{
+  if (this->primitiveTypes.empty()) {
+    // Start watching for redefinitions of the primitive templates.
+    this->rootManager->getRootScope()->changeNotifier.connect(this->rootScopeChangeSlot);
+  }
+  this->primitiveTypes[Helper::getPrimitiveTypeKey(kind, size)] = type;
+}
+
+
 //==============================================================================
 // Main Functions
 
@@ -573,6 +612,8 @@ IntegerType* Helper::_getCharType(TiObject *self)
 ArrayType* Helper::_getCharArrayType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
+  auto cachedType = static_cast<ArrayType*>(helper->findPrimitiveType(PrimitiveTypeKind::CHAR_ARRAY, size));
+  if (cachedType != 0) return cachedType;
 
   // Prepare the reference.
   if (helper->charArrayTypeRef == 0) {
@@ -599,6 +640,7 @@ ArrayType* Helper::_getCharArrayType(TiObject *self, Word size)
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get char array AST type."));
   }
+  helper->addPrimitiveType(PrimitiveTypeKind::CHAR_ARRAY, size, astType);
   return astType;
 }
 
@@ -616,6 +658,9 @@ IntegerType* Helper::_getArchIntType(TiObject *self)
 IntegerType* Helper::_getIntType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
+  auto cachedType = static_cast<IntegerType*>(helper->findPrimitiveType(PrimitiveTypeKind::INT, size));
+  if (cachedType != 0) return cachedType;
+
   // Prepare the reference.
   if (helper->integerTypeRef == 0) {
     // Create a new reference.
@@ -639,6 +684,7 @@ IntegerType* Helper::_getIntType(TiObject *self, Word size)
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get integer AST type."));
   }
+  helper->addPrimitiveType(PrimitiveTypeKind::INT, size, astType);
   return astType;
 }
 
@@ -656,6 +702,9 @@ IntegerType* Helper::_getWord64Type(TiObject *self)
 IntegerType* Helper::_getWordType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
+  auto cachedType = static_cast<IntegerType*>(helper->findPrimitiveType(PrimitiveTypeKind::WORD, size));
+  if (cachedType != 0) return cachedType;
+
   // Prepare the reference.
   if (helper->wordTypeRef == 0) {
     // Create a new reference.
@@ -679,6 +728,7 @@ IntegerType* Helper::_getWordType(TiObject *self, Word size)
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get integer AST type."));
   }
+  helper->addPrimitiveType(PrimitiveTypeKind::WORD, size, astType);
   return astType;
 }
 
@@ -686,6 +736,9 @@ IntegerType* Helper::_getWordType(TiObject *self, Word size)
 FloatType* Helper::_getFloatType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
+  auto cachedType = static_cast<FloatType*>(helper->findPrimitiveType(PrimitiveTypeKind::FLOAT, size));
+  if (cachedType != 0) return cachedType;
+
   // Prepare the reference.
   if (helper->floatTypeRef == 0) {
     // Create a new reference.
@@ -709,6 +762,7 @@ FloatType* Helper::_getFloatType(TiObject *self, Word size)
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get float AST type."));
   }
+  helper->addPrimitiveType(PrimitiveTypeKind::FLOAT, size, astType);
   return astType;
 }
 
@@ -51,6 +51,19 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   private: SharedPtr<Core::Data::Ast::ParamPass> floatTypeRef;
   private: SharedPtr<Core::Data::Ast::ParamPass> charArrayTypeRef;
 
+  /**
+   * @brief The primitive types resolved so far, keyed by getPrimitiveTypeKey.
+   *
+   * This saves re-seeking the Int, Word, Float, and array templates every
+   * time a primitive type is needed. The table is cleared whenever any of
+   * those templates is redefined in the root scope.
+   */
+  private: std::unordered_map<LongWord, Type*> primitiveTypes;
+
+  private: Slot<void, SharedListBase<TiObject, Core::Data::Node>*, ContentChangeOp, Int> rootScopeChangeSlot = {
+    this, &Helper::onRootScopeChanged
+  };
+
 
   //============================================================================
   // Implementations
@@ -93,6 +106,10 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
     this->refTemplate = 0;
   }
 
+  private: void onRootScopeChanged(SharedListBase<TiObject, Core::Data::Node> *scope, ContentChangeOp op, Int index);
+
+  private: void clearPrimitiveTypes();
+
   /// @}
 
   /// @name Property Getters
@@ -217,6 +234,19 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: METHOD_BINDING_CACHE(getFloatType, FloatType*, (Word));
   private: static FloatType* _getFloatType(TiObject *self, Word size);
 
+  private: static LongWord getPrimitiveTypeKey(PrimitiveTypeKind kind, Word size)
+  {
+    return (static_cast<LongWord>(kind.val) << 32) | size;
+  }
+
+  private: Type* findPrimitiveType(PrimitiveTypeKind kind, Word size)
+  {
+    auto it = this->primitiveTypes.find(Helper::getPrimitiveTypeKey(kind, size));
+    return it == this->primitiveTypes.end() ? 0 : it->second;
+  }
+
+  private: void addPrimitiveType(PrimitiveTypeKind kind, Word size, Type *type);
+
   public: METHOD_BINDING_CACHE(getVoidType, VoidType*);
   private: static VoidType* _getVoidType(TiObject *self);
 
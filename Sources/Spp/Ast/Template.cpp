@@ -15,6 +15,14 @@
 namespace Spp::Ast
 {
 
+//==============================================================================
+// Static Variables
+
+Word Template::totalInstanceCount = 0;
+Word Template::instanceLookupCount = 0;
+Word Template::instanceLookupHitCount = 0;
+
+
 //==============================================================================
 // Member Functions
 
@@ -35,6 +43,9 @@ TioSharedPtr const& Template::getDefaultInstance(Helper *helper)
   block->add(Core::Data::Ast::clone(this->body.get()));
   this->instances.add(block);
   block->setOwner(this);
+  // Templates without vars match any instance, so make the default instance visible to matchInstance.
+  if (this->getVarDefCount() == 0) this->instanceIndex.insert({ 0, this->instances.getCount() - 1 });
+  ++Template::totalInstanceCount;
   return this->instances.get(this->instances.getCount() - 1)->get(0);
 }
 
@@ -54,11 +65,14 @@ Bool Template::matchInstance(TiObject *templateInputs, Helper *helper, TioShared
     return false;
   }
 
-  // Do we already have an instance?
-  auto count = this->instances.getCount();
-  for (Int i = 0; i < count; ++i) {
-    if (this->matchTemplateVars(&vars, this->instances.getElement(i), helper, notice)) {
-      result = this->instances.get(i)->get(0);
+  // Do we already have an instance? Only instances with matching hashes need to be checked.
+  ++Template::instanceLookupCount;
+  auto hash = this->computeTemplateVarsHash(&vars);
+  auto range = this->instanceIndex.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (this->matchTemplateVars(&vars, this->instances.getElement(it->second), helper, notice)) {
+      ++Template::instanceLookupHitCount;
+      result = this->instances.get(it->second)->get(0);
       return true;
     } else {
       if (notice != 0) {
@@ -78,6 +92,8 @@ Bool Template::matchInstance(TiObject *templateInputs, Helper *helper, TioShared
   }
   this->instances.add(block);
   block->setOwner(this);
+  this->instanceIndex.insert({ hash, this->instances.getCount() - 1 });
+  ++Template::totalInstanceCount;
   result = this->instances.get(this->instances.getCount() - 1)->get(0);
   return true;
 }
@@ -123,6 +139,53 @@ Bool Template::prepareTemplateVars(
 }
 
 
+/**
+ * Computes a hash of the given template vars that is equal for any two lists
+ * of vars that matchTemplateVars considers a match.
+ */
+Word Template::computeTemplateVarsHash(Containing<TiObject> *templateInputs)
+{
+  Word hash = 0;
+  for (Int i = 0; i < this->getVarDefCount(); ++i) {
+    auto varDef = this->varDefs->get(i).s_cast_get<TemplateVarDef>();
+    ASSERT(varDef != 0);
+    auto varHash = this->computeTemplateVarHash(templateInputs->getElement(i), varDef);
+    hash ^= varHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+
+Word Template::computeTemplateVarHash(TiObject *templateInput, TemplateVarDef *varDef)
+{
+  switch (varDef->getType().get()) {
+    case TemplateVarType::INTEGER: {
+      auto var = static_cast<Core::Data::Ast::IntegerLiteral*>(templateInput);
+      return std::hash<long>()(std::stol(var->getValue().get()));
+    }
+
+    case TemplateVarType::STRING: {
+      auto var = static_cast<Core::Data::Ast::StringLiteral*>(templateInput);
+      return std::hash<Str>()(var->getValue().getStr());
+    }
+
+    case TemplateVarType::TYPE: {
+      // Function types are matched by structure rather than identity, so they all share the same hash.
+      if (templateInput->isA<Spp::Ast::FunctionType>()) return std::hash<void const*>()(FunctionType::getTypeInfo());
+      else return std::hash<void const*>()(templateInput);
+    }
+
+    case TemplateVarType::AST: {
+      return Core::Data::Ast::computeHash(templateInput);
+    }
+
+    default: {
+      return std::hash<void const*>()(templateInput);
+    }
+  }
+}
+
+
 Bool Template::matchTemplateVars(
   Containing<TiObject> *templateInputs, Core::Data::Ast::Scope *instance, Helper *helper,
   SharedPtr<Core::Notices::Notice> &notice
@@ -40,6 +40,14 @@ class Template : public Core::Data::Node,
 
   private: SharedList<Core::Data::Ast::Scope> instances;
 
+  /// Maps the hashes of the template vars of each instance to the index of that instance.
+  private: std::unordered_multimap<Word, Int> instanceIndex;
+
+  /// Counts of instance lookups across all templates.
+  private: static Word totalInstanceCount;
+  private: static Word instanceLookupCount;
+  private: static Word instanceLookupHitCount;
+
 
   //============================================================================
   // Implementations
@@ -116,6 +124,9 @@ class Template : public Core::Data::Node,
     TiObject *templateInputs, Helper *helper, PlainList<TiObject> *vars, SharedPtr<Core::Notices::Notice> &notice
   );
 
+  private: Word computeTemplateVarsHash(Containing<TiObject> *templateInputs);
+  private: Word computeTemplateVarHash(TiObject *templateInput, TemplateVarDef *varDef);
+
   private: Bool matchTemplateVars(
     Containing<TiObject> *templateInputs, Core::Data::Ast::Scope *instance, Helper *helper,
     SharedPtr<Core::Notices::Notice> &notice
@@ -144,6 +155,24 @@ class Template : public Core::Data::Node,
     return this->instances.get(index);
   }
 
+  /// Get the number of instances created across all templates.
+  public: static Word getTotalInstanceCount()
+  {
+    return Template::totalInstanceCount;
+  }
+
+  /// Get the number of times an instance was looked up across all templates.
+  public: static Word getInstanceLookupCount()
+  {
+    return Template::instanceLookupCount;
+  }
+
+  /// Get the number of instance lookups that found an existing instance.
+  public: static Word getInstanceLookupHitCount()
+  {
+    return Template::instanceLookupHitCount;
+  }
+
 
   //============================================================================
   // Mergeable Implementation
@@ -33,6 +33,25 @@ Char const* findOperationModifier(Core::Data::Ast::Definition const *def)
 }
 
 
+Char const* findIntrinsicModifier(Core::Data::Ast::Definition const *def)
+{
+  auto modifiers = def->getModifiers().get();
+  if (modifiers != 0) {
+    for (Int i = 0; i < modifiers->getElementCount(); ++i) {
+      auto paramPass = ti_cast<Core::Data::Ast::ParamPass>(modifiers->getElement(i));
+      if (paramPass != 0) {
+        auto identifier = paramPass->getOperand().ti_cast_get<Core::Data::Ast::Identifier>();
+        if (identifier != 0 && identifier->getValue() == S("intrinsic")) {
+          auto stringLiteral = paramPass->getParam().ti_cast_get<Core::Data::Ast::StringLiteral>();
+          if (stringLiteral != 0) return stringLiteral->getValue().get();
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+
 Bool isInjection(Core::Data::Ast::Definition *def)
 {
   auto modifiers = def->getModifiers().get();
@@ -34,6 +34,9 @@ class Type;
 //==============================================================================
 // Types
 
+/// @ingroup spp_ast
+s_enum(PrimitiveTypeKind, INT, WORD, FLOAT, CHAR_ARRAY);
+
 /// @ingroup spp_ast
 s_enum(TypeMatchOptions,
   NONE = 0,
@@ -118,6 +121,8 @@ class Function;
 
 Char const* findOperationModifier(Core::Data::Ast::Definition const *def);
 
+Char const* findIntrinsicModifier(Core::Data::Ast::Definition const *def);
+
 Bool isInjection(Core::Data::Ast::Definition *def);
 
 Function* getDummyBuiltInOpFunction();
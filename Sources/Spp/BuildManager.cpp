@@ -74,13 +74,15 @@ void BuildManager::initNonOfflineBuildSessions()
 {
   // Prepare build targets and target generators.
 
-  auto jitBuildTarget = newSrdObj<LlvmCodeGen::JitBuildTarget>(this->globalItemRepo);
+  auto jitBuildTarget = newSrdObj<LlvmCodeGen::JitBuildTarget>(this->globalItemRepo, &this->jitObjectCache);
   auto jitTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
     this->rootManager, jitBuildTarget.get(), false
   );
   jitTargetGenerator->setupBuild();
 
-  auto preprocessBuildTarget = newSrdObj<LlvmCodeGen::LazyJitBuildTarget>(this->globalItemRepo);
+  auto preprocessBuildTarget = newSrdObj<LlvmCodeGen::LazyJitBuildTarget>(
+    this->globalItemRepo, &this->jitObjectCache
+  );
   auto preprocessTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
     jitTargetGenerator.get(), preprocessBuildTarget.get(), true
   );
@@ -126,6 +128,62 @@ SharedPtr<BuildSession> BuildManager::createOfflineBuildSession(Char const *targ
 }
 
 
+//==============================================================================
+// JIT Optimization Functions
+
+void BuildManager::getJitOptimizationStats(Word &moduleCount, LongWord &totalTime) const
+{
+  moduleCount = 0;
+  totalTime = 0;
+  auto jitEngine = this->jitBuildSession->getBuildTarget().s_cast<LlvmCodeGen::JitBuildTarget>()->getJitEngine();
+  if (jitEngine != 0) {
+    moduleCount += jitEngine->getOptimizedModuleCount();
+    totalTime += jitEngine->getTotalOptimizationTime();
+  }
+  auto lazyJitEngine =
+    this->preprocessBuildSession->getBuildTarget().s_cast<LlvmCodeGen::LazyJitBuildTarget>()->getJitEngine();
+  if (lazyJitEngine != 0) {
+    moduleCount += lazyJitEngine->getOptimizedModuleCount();
+    totalTime += lazyJitEngine->getTotalOptimizationTime();
+  }
+}
+
+
+void BuildManager::getJitTieringStats(Word &tieredFunctionCount, Word &tieredUpFunctionCount)
+{
+  tieredFunctionCount = 0;
+  tieredUpFunctionCount = 0;
+  auto jitEngine = this->jitBuildSession->getBuildTarget().s_cast<LlvmCodeGen::JitBuildTarget>()->getJitEngine();
+  if (jitEngine != 0) {
+    jitEngine->waitForTierUps();
+    tieredFunctionCount += jitEngine->getTieredFunctionCount();
+    tieredUpFunctionCount += jitEngine->getTieredUpFunctionCount();
+  }
+  auto lazyJitEngine =
+    this->preprocessBuildSession->getBuildTarget().s_cast<LlvmCodeGen::LazyJitBuildTarget>()->getJitEngine();
+  if (lazyJitEngine != 0) {
+    lazyJitEngine->waitForTierUps();
+    tieredFunctionCount += lazyJitEngine->getTieredFunctionCount();
+    tieredUpFunctionCount += lazyJitEngine->getTieredUpFunctionCount();
+  }
+}
+
+
+void BuildManager::applyJitOptimizationSettings(BuildSession *buildSession)
+{
+  if (buildSession->getBuildType() == BuildType::JIT) {
+    auto buildTarget = buildSession->getBuildTarget().s_cast<LlvmCodeGen::JitBuildTarget>();
+    buildTarget->setOptimizationLevel(this->jitOptimizationLevel);
+    buildTarget->setOptimizationTimeReporting(this->jitOptimizationTimeReporting);
+    buildTarget->setProfiling(this->jitProfileMode, this->jitProfileFilename.getBuf());
+  } else if (buildSession->getBuildType() == BuildType::PREPROCESS) {
+    auto buildTarget = buildSession->getBuildTarget().s_cast<LlvmCodeGen::LazyJitBuildTarget>();
+    buildTarget->setOptimizationLevel(this->jitOptimizationLevel);
+    buildTarget->setOptimizationTimeReporting(this->jitOptimizationTimeReporting);
+  }
+}
+
+
 //==============================================================================
 // Build Functions
 
@@ -145,6 +203,10 @@ SharedPtr<BuildSession> BuildManager::_prepareBuild(TiObject *self, Int buildTyp
     throw EXCEPTION(InvalidArgumentException, S("buildType"), S("Invalid build type"), buildType);
   }
 
+  if (buildSession->getBuildType() != BuildManager::BuildType::OFFLINE) {
+    buildMgr->applyJitOptimizationSettings(buildSession.get());
+  }
+
   if (buildSession->getBuildType() != BuildManager::BuildType::OFFLINE && buildMgr->rootManager->isInteractive()) {
     // If we are running in an interactive mode and we faced previous errors, we'll try to clear the errors and start
     // fresh to give the user a chance to correct the errors if possible.
@@ -166,6 +228,7 @@ SharedPtr<BuildSession> BuildManager::_prepareBuild(TiObject *self, Int buildTyp
 
 void BuildManager::_prepareExecutionEntry(TiObject *self, BuildSession *buildSession)
 {
+  Core::Basic::PhaseStats::Timer timer(Core::Basic::PhaseStats::Phase::IR_GENERATION);
   PREPARE_SELF(buildMgr, BuildManager);
   auto generation = ti_cast<CodeGen::Generation>(buildMgr->generator);
 
@@ -187,6 +250,7 @@ void BuildManager::_prepareExecutionEntry(TiObject *self, BuildSession *buildSes
 
 Bool BuildManager::_finalizeExecutionEntry(TiObject *self, BuildSession *buildSession)
 {
+  Core::Basic::PhaseStats::Timer timer(Core::Basic::PhaseStats::Phase::IR_GENERATION);
   if (buildSession->getExecutionEntryTgFunc() == 0 || buildSession->getExecutionEntryTgContext() == 0) {
     throw EXCEPTION(
       GenericException,
@@ -216,6 +280,7 @@ Bool BuildManager::_finalizeExecutionEntry(TiObject *self, BuildSession *buildSe
 
 Bool BuildManager::_addElementToBuild(TiObject *self, TiObject *element, BuildSession *buildSession)
 {
+  Core::Basic::PhaseStats::Timer timer(Core::Basic::PhaseStats::Phase::IR_GENERATION);
   PREPARE_SELF(buildMgr, BuildManager);
 
   auto generation = ti_cast<CodeGen::Generation>(buildMgr->generator);
@@ -238,6 +303,7 @@ Bool BuildManager::_addElementToBuild(TiObject *self, TiObject *element, BuildSe
 
 Bool BuildManager::_addElementToExecutionEntry(TiObject *self, TiObject *element, BuildSession *buildSession)
 {
+  Core::Basic::PhaseStats::Timer timer(Core::Basic::PhaseStats::Phase::IR_GENERATION);
   PREPARE_SELF(buildMgr, BuildManager);
   auto generation = ti_cast<CodeGen::Generation>(buildMgr->generator);
 
@@ -343,8 +409,13 @@ void BuildManager::_dumpLlvmIrForElement(TiObject *self, TiObject *element)
 }
 
 
+/**
+ * @param options The options to generate the object file with, or null to
+ *                generate it unoptimized for a generic CPU.
+ */
 Bool BuildManager::_buildObjectFileForElement(
-  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  LlvmCodeGen::OfflineBuildTarget::ObjectFileOptions const *options
 ) {
   VALIDATE_NOT_NULL(element);
   PREPARE_SELF(buildMgr, BuildManager);
@@ -362,9 +433,12 @@ Bool BuildManager::_buildObjectFileForElement(
   if (result) {
     Array<Str> globalCtorNames = BuildManager::getGlobalCtorNames(buildSession.get());
     Array<Str> globalDtorNames = BuildManager::getGlobalDtorNames(buildSession.get());
-    buildSession->getBuildTarget().s_cast<LlvmCodeGen::OfflineBuildTarget>()->generateObjectFile(
-      objectFilename, &globalCtorNames, &globalDtorNames
-    );
+    auto buildTarget = buildSession->getBuildTarget().s_cast<LlvmCodeGen::OfflineBuildTarget>();
+    if (options == 0) {
+      buildTarget->generateObjectFile(objectFilename, &globalCtorNames, &globalDtorNames);
+    } else {
+      buildTarget->generateObjectFile(objectFilename, &globalCtorNames, &globalDtorNames, *options);
+    }
   }
 
   buildMgr->resetBuild(buildSession.get());
@@ -395,13 +469,7 @@ void BuildManager::_resetBuildData(TiObject *self, TiObject *obj, CodeGen::Extra
 
   auto metahaving = ti_cast<Core::Data::Ast::MetaHaving>(obj);
   if (metahaving != 0) {
-    eda->removeCodeGenData(metahaving);
-    eda->removeAutoCtor(metahaving);
-    eda->removeAutoCtorType(metahaving);
-    eda->removeAutoDtor(metahaving);
-    eda->removeAutoDtorType(metahaving);
-    eda->resetCodeGenFailed(metahaving);
-    eda->resetInitStatementsGenIndex(metahaving);
+    eda->removeSessionData(metahaving);
   }
 
   if (obj->isDerivedFrom<Core::Data::Ast::Passage>()) return;
@@ -54,6 +54,13 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
 
   private: Int funcNameIndex = 0;
 
+  private: LlvmCodeGen::JitOptimizationLevel jitOptimizationLevel = LlvmCodeGen::JitOptimizationLevel::O3;
+  private: Bool jitOptimizationTimeReporting = false;
+  private: LlvmCodeGen::ProfileMode jitProfileMode = LlvmCodeGen::ProfileMode::NONE;
+  private: Str jitProfileFilename;
+
+  private: LlvmCodeGen::JitObjectCache jitObjectCache;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -121,6 +128,90 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
 
   /// @}
 
+  /// @name JIT Optimization Functions
+  /// @{
+
+  /**
+   * @brief Set the optimization level of JIT and preprocess builds.
+   *
+   * The level takes effect for build sessions prepared after this call.
+   */
+  public: void setJitOptimizationLevel(LlvmCodeGen::JitOptimizationLevel level)
+  {
+    this->jitOptimizationLevel = level;
+  }
+
+  public: LlvmCodeGen::JitOptimizationLevel getJitOptimizationLevel() const
+  {
+    return this->jitOptimizationLevel;
+  }
+
+  /// Set whether to print the time spent optimizing each JIT module.
+  public: void setJitOptimizationTimeReporting(Bool enabled)
+  {
+    this->jitOptimizationTimeReporting = enabled;
+  }
+
+  public: Bool isJitOptimizationTimeReporting() const
+  {
+    return this->jitOptimizationTimeReporting;
+  }
+
+  /**
+   * @brief Set the profile guided optimization mode of JIT builds.
+   *
+   * In GENERATE mode the counters are written to the given file when the
+   * JIT engine is torn down, which happens when the build is reset or when
+   * the program exits. Like the optimization level, this takes effect for
+   * build sessions prepared after this call.
+   */
+  public: void setJitProfiling(LlvmCodeGen::ProfileMode mode, Char const *filename)
+  {
+    this->jitProfileMode = mode;
+    this->jitProfileFilename = filename;
+  }
+
+  public: LlvmCodeGen::ProfileMode getJitProfileMode() const
+  {
+    return this->jitProfileMode;
+  }
+
+  public: Str const& getJitProfileFilename() const
+  {
+    return this->jitProfileFilename;
+  }
+
+  /// Get the number of JIT modules optimized so far and the total time spent on them in microseconds.
+  public: void getJitOptimizationStats(Word &moduleCount, LongWord &totalTime) const;
+
+  /**
+   * @brief Get the number of functions compiled in tiered mode and the number
+   *        of them recompiled at O3 after getting hot.
+   * Waits for pending recompilations first so that the counts are stable.
+   */
+  public: void getJitTieringStats(Word &tieredFunctionCount, Word &tieredUpFunctionCount);
+
+  private: void applyJitOptimizationSettings(BuildSession *buildSession);
+
+  /**
+   * @brief Set the directory of the on-disk cache of JIT compiled objects.
+   *
+   * Objects compiled from identical IR with identical settings are loaded
+   * from this directory instead of being optimized and compiled again. An
+   * empty path disables the cache, which is the default.
+   */
+  public: void setJitCacheDirectory(Char const *dir)
+  {
+    this->jitObjectCache.setDirectory(dir);
+  }
+
+  public: LlvmCodeGen::JitObjectCache* getJitObjectCache()
+  {
+    return &this->jitObjectCache;
+  }
+
+  /// @}
+
   /// @name Code Generation Functions
   /// @{
 
@@ -149,9 +240,12 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
   public: METHOD_BINDING_CACHE(dumpLlvmIrForElement, void, (TiObject*));
   public: static void _dumpLlvmIrForElement(TiObject *self, TiObject *element);
 
-  public: METHOD_BINDING_CACHE(buildObjectFileForElement, Bool, (TiObject*, Char const*, Char const*));
+  public: METHOD_BINDING_CACHE(buildObjectFileForElement,
+    Bool, (TiObject*, Char const*, Char const*, LlvmCodeGen::OfflineBuildTarget::ObjectFileOptions const*)
+  );
   public: static Bool _buildObjectFileForElement(
-    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    LlvmCodeGen::OfflineBuildTarget::ObjectFileOptions const *options
   );
 
   public: METHOD_BINDING_CACHE(resetBuild, void, (BuildSession*));
@@ -16,12 +16,22 @@
 namespace Spp { namespace CodeGen
 {
 
-template<class CTYPE> class DependencyList : public PlainList<CTYPE>
+/**
+ * @brief A list of code generation dependencies with no duplicates.
+ * @ingroup spp_codegen
+ *
+ * The elements are kept in a deque so that the list can be consumed from the
+ * front and high priority elements can be added at the front in constant
+ * time, while a hash set of the same elements is used for membership checks,
+ * so adding to the list doesn't need to scan it.
+ */
+template<class CTYPE> class DependencyList
 {
   //============================================================================
-  // Constructor & Destructor
+  // Member Variables
 
-  public: using PlainList<CTYPE>::PlainList;
+  private: std::deque<CTYPE*> elements;
+  private: std::unordered_set<CTYPE*> members;
 
 
   //============================================================================
@@ -29,13 +39,49 @@ template<class CTYPE> class DependencyList : public PlainList<CTYPE>
 
   public: void add(CTYPE *f, Bool highPriority)
   {
-    if (this->find(f) != -1) return;
-    if (highPriority) PlainList<CTYPE>::insert(0, f);
-    else PlainList<CTYPE>::add(f);
+    if (!this->members.insert(f).second) return;
+    if (highPriority) this->elements.push_front(f);
+    else this->elements.push_back(f);
+  }
+
+  public: CTYPE* takeFirst()
+  {
+    auto f = this->elements.front();
+    this->elements.pop_front();
+    this->members.erase(f);
+    return f;
+  }
+
+  public: void remove(Int index)
+  {
+    this->members.erase(this->elements[index]);
+    this->elements.erase(this->elements.begin() + index);
+  }
+
+  public: void clear()
+  {
+    this->members.clear();
+    this->elements.clear();
+  }
+
+  public: CTYPE* get(Int index) const
+  {
+    return this->elements[index];
+  }
+
+  public: Int getCount() const
+  {
+    return this->elements.size();
+  }
+
+  public: Bool contains(CTYPE *f) const
+  {
+    return this->members.find(f) != this->members.end();
   }
 
   public: Int find(CTYPE *f) const
   {
+    if (!this->contains(f)) return -1;
     for (Int i = 0; i < this->getCount(); ++i) {
       if (this->get(i) == f) return i;
     }
@@ -63,6 +63,7 @@ void ExpressionGenerator::initBindingCaches()
     &this->generateMemberVarReference,
     &this->generateArrayReference,
     &this->generateFunctionCall,
+    &this->generateIntrinsicCall,
     &this->generateFunctionPtrCall,
     &this->prepareFunctionParams,
     &this->prepareCallee,
@@ -118,6 +119,7 @@ void ExpressionGenerator::initBindings()
   this->generateMemberVarReference = &ExpressionGenerator::_generateMemberVarReference;
   this->generateArrayReference = &ExpressionGenerator::_generateArrayReference;
   this->generateFunctionCall = &ExpressionGenerator::_generateFunctionCall;
+  this->generateIntrinsicCall = &ExpressionGenerator::_generateIntrinsicCall;
   this->generateFunctionPtrCall = &ExpressionGenerator::_generateFunctionPtrCall;
   this->prepareFunctionParams = &ExpressionGenerator::_prepareFunctionParams;
   this->prepareCallee = &ExpressionGenerator::_prepareCallee;
@@ -2668,6 +2670,12 @@ Bool ExpressionGenerator::_generateFunctionCall(
 ) {
   PREPARE_SELF(expGenerator, ExpressionGenerator);
 
+  auto calleeDef = ti_cast<Core::Data::Ast::Definition>(callee->getOwner());
+  auto intrinsic = calleeDef == 0 ? 0 : Ast::findIntrinsicModifier(calleeDef);
+  if (intrinsic != 0) {
+    return expGenerator->generateIntrinsicCall(astNode, callee, intrinsic, paramTgValues, g, session, result);
+  }
+
   if (callee->getInlined()) {
     // TODO: Generate inlined function body.
     throw EXCEPTION(GenericException, S("Inline function generation is not implemented yet."));
@@ -2724,6 +2732,139 @@ Bool ExpressionGenerator::_generateFunctionCall(
 }
 
 
+Bool ExpressionGenerator::_generateIntrinsicCall(
+  TiObject *self, Core::Data::Node *astNode, Spp::Ast::Function *callee, Char const *intrinsic,
+  Containing<TiObject> *paramTgValues, Generation *g, Session *session, GenResult &result
+) {
+  PREPARE_SELF(expGenerator, ExpressionGenerator);
+  auto helper = expGenerator->astHelper;
+  auto calleeType = callee->getType().get();
+
+  // Determine the operation. Other than the fence, all the intrinsics operate on a value pointed to by the first
+  // arg, and all of them take their memory orders as their last args.
+  Str name(intrinsic);
+  Word argCount;
+  Bool integerOnly = false;
+  AtomicRmwOperation rmwOperation;
+  if (name == S("atomic_load")) {
+    argCount = 2;
+  } else if (name == S("atomic_store")) {
+    argCount = 3;
+  } else if (name == S("atomic_exchange")) {
+    argCount = 3;
+    rmwOperation = AtomicRmwOperation::EXCHANGE;
+  } else if (name == S("atomic_fetch_add")) {
+    argCount = 3;
+    integerOnly = true;
+    rmwOperation = AtomicRmwOperation::ADD;
+  } else if (name == S("atomic_fetch_sub")) {
+    argCount = 3;
+    integerOnly = true;
+    rmwOperation = AtomicRmwOperation::SUB;
+  } else if (name == S("atomic_fetch_and")) {
+    argCount = 3;
+    integerOnly = true;
+    rmwOperation = AtomicRmwOperation::AND;
+  } else if (name == S("atomic_fetch_or")) {
+    argCount = 3;
+    integerOnly = true;
+    rmwOperation = AtomicRmwOperation::OR;
+  } else if (name == S("atomic_fetch_xor")) {
+    argCount = 3;
+    integerOnly = true;
+    rmwOperation = AtomicRmwOperation::XOR;
+  } else if (name == S("atomic_compare_exchange")) {
+    argCount = 5;
+  } else if (name == S("atomic_fence")) {
+    argCount = 1;
+  } else {
+    argCount = 0;
+  }
+
+  // Validate the signature.
+  Bool valid = argCount != 0 && !calleeType->isVariadic() && calleeType->getArgCount() == argCount;
+  auto astRetType = calleeType->traceRetType(helper);
+  Ast::Type *astContentType = 0;
+  if (valid && name != S("atomic_fence")) {
+    auto astPtrType = ti_cast<Ast::PointerType>(calleeType->traceArgType(0, helper));
+    astContentType = astPtrType == 0 ? 0 : astPtrType->getContentType(helper);
+    valid =
+      astContentType != 0 &&
+      (astContentType->isDerivedFrom<Ast::IntegerType>() ||
+        (!integerOnly && astContentType->isDerivedFrom<Ast::PointerType>())) &&
+      calleeType->traceArgType(argCount - 1, helper)->isDerivedFrom<Ast::IntegerType>();
+    if (valid) {
+      // Atomic instructions only accept integers that are a power of two bytes in size, so Bool and other odd
+      // sized integers are rejected.
+      auto astIntType = ti_cast<Ast::IntegerType>(astContentType);
+      if (astIntType != 0) {
+        auto bitCount = astIntType->getBitCount(helper);
+        valid = bitCount >= 8 && (bitCount & (bitCount - 1)) == 0;
+      }
+    }
+    if (valid) {
+      if (name == S("atomic_load")) {
+        valid = astRetType->isIdentical(astContentType, helper);
+      } else if (name == S("atomic_store")) {
+        valid = calleeType->traceArgType(1, helper)->isIdentical(astContentType, helper) &&
+          astRetType->isDerivedFrom<Ast::VoidType>();
+      } else if (name == S("atomic_compare_exchange")) {
+        auto astExpectedType = ti_cast<Ast::PointerType>(calleeType->traceArgType(1, helper));
+        valid = astExpectedType != 0 && astExpectedType->getContentType(helper)->isIdentical(astContentType, helper) &&
+          calleeType->traceArgType(2, helper)->isIdentical(astContentType, helper) &&
+          calleeType->traceArgType(3, helper)->isDerivedFrom<Ast::IntegerType>() &&
+          astRetType->isIdentical(helper->getBoolType(), helper);
+      } else {
+        valid = calleeType->traceArgType(1, helper)->isIdentical(astContentType, helper) &&
+          astRetType->isIdentical(astContentType, helper);
+      }
+    }
+  } else if (valid) {
+    valid = calleeType->traceArgType(0, helper)->isDerivedFrom<Ast::IntegerType>() &&
+      astRetType->isDerivedFrom<Ast::VoidType>();
+  }
+  if (!valid) {
+    expGenerator->astHelper->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidIntrinsicNotice>(Core::Data::Ast::findSourceLocation(astNode))
+    );
+    return false;
+  }
+
+  result.astType = astRetType;
+  if (session->getTgContext() == 0) return true;
+
+  auto tg = session->getTg();
+  auto tgContext = session->getTgContext();
+  if (name == S("atomic_fence")) {
+    return tg->generateAtomicFence(tgContext, paramTgValues->getElement(0));
+  }
+
+  TiObject *tgContentType;
+  if (!g->getGeneratedType(astContentType, session, tgContentType, 0)) return false;
+
+  if (name == S("atomic_load")) {
+    return tg->generateAtomicLoad(
+      tgContext, tgContentType, paramTgValues->getElement(0), paramTgValues->getElement(1), result.targetData
+    );
+  } else if (name == S("atomic_store")) {
+    return tg->generateAtomicStore(
+      tgContext, tgContentType, paramTgValues->getElement(1), paramTgValues->getElement(0),
+      paramTgValues->getElement(2)
+    );
+  } else if (name == S("atomic_compare_exchange")) {
+    return tg->generateAtomicCompareExchange(
+      tgContext, tgContentType, paramTgValues->getElement(0), paramTgValues->getElement(1),
+      paramTgValues->getElement(2), paramTgValues->getElement(3), paramTgValues->getElement(4), result.targetData
+    );
+  } else {
+    return tg->generateAtomicRmw(
+      tgContext, tgContentType, rmwOperation, paramTgValues->getElement(0), paramTgValues->getElement(1),
+      paramTgValues->getElement(2), result.targetData
+    );
+  }
+}
+
+
 Bool ExpressionGenerator::_generateFunctionPtrCall(
   TiObject *self, Core::Data::Node *astNode, Spp::Ast::FunctionType *astFuncType,
   TiObject *tgFuncPtr, TiObject *tgFuncPtrType, Containing<TiObject> *paramTgValues,
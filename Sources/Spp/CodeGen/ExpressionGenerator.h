@@ -558,6 +558,17 @@ class ExpressionGenerator : public TiObject, public DynamicBinding, public Dynam
     Generation *g, Session *session, GenResult &result
   );
 
+  public: METHOD_BINDING_CACHE(generateIntrinsicCall,
+    Bool, (
+      Core::Data::Node* /* astNode */, Spp::Ast::Function* /* callee */, Char const* /* intrinsic */,
+      Containing<TiObject>* /* paramTgValues */, Generation* /* g */, Session* /* session */, GenResult& /* result */
+    )
+  );
+  private: static Bool _generateIntrinsicCall(
+    TiObject *self, Core::Data::Node *astNode, Spp::Ast::Function *callee, Char const *intrinsic,
+    Containing<TiObject> *paramTgValues, Generation *g, Session *session, GenResult &result
+  );
+
   public: METHOD_BINDING_CACHE(generateFunctionPtrCall,
     Bool, (
       Core::Data::Node* /* astNode */, Spp::Ast::FunctionType* /* astFuncType */,
@@ -41,15 +41,18 @@ class ExtraDataAccessor : public TiObject
   //============================================================================
   // Member Variables
 
-  private: Str idCodeGenData;
-  private: Str idAutoCtor;
-  private: Str idAutoCtorType;
-  private: Str idAutoDtor;
-  private: Str idAutoDtorType;
-  private: Str idCodeGenFailed;
-  private: Str idInitStatementGenIndex;
-  private: Str idBuildId;
-  private: Str idGlobalVarState;
+  private: Word idCodeGenData;
+  private: Word idAutoCtor;
+  private: Word idAutoCtorType;
+  private: Word idAutoDtor;
+  private: Word idAutoDtorType;
+  private: Word idCodeGenFailed;
+  private: Word idInitStatementGenIndex;
+  private: Word idBuildId;
+  private: Word idGlobalVarState;
+
+  /// The slots that belong to this build session alone, excluding the shared ones.
+  private: Word sessionIds[7];
 
 
   //============================================================================
@@ -68,16 +71,30 @@ class ExtraDataAccessor : public TiObject
   {
     Str idPrefix = prefix;
     Str sharedIdPrefix = sharedPrefix != 0 ? Str(sharedPrefix) : idPrefix;
-    this->idCodeGenData = idPrefix + S("codeGenData");
-    this->idAutoCtor = idPrefix + S("autoCtor");
-    this->idAutoCtorType = idPrefix + S("autoCtorType");
-    this->idAutoDtor = idPrefix + S("autoDtor");
-    this->idAutoDtorType = idPrefix + S("autoDtorType");
-    this->idCodeGenFailed = idPrefix + S("codeGenFailed");
-    this->idInitStatementGenIndex = idPrefix + S("initStatementGenIndex");
-
-    this->idBuildId = sharedIdPrefix + S("buildId");
-    this->idGlobalVarState = sharedIdPrefix + S("globalVarState");
+    this->idCodeGenData = Core::Data::Ast::ExtraSlots::getId(idPrefix + S("codeGenData"));
+    this->idAutoCtor = Core::Data::Ast::ExtraSlots::getId(idPrefix + S("autoCtor"));
+    this->idAutoCtorType = Core::Data::Ast::ExtraSlots::getId(idPrefix + S("autoCtorType"));
+    this->idAutoDtor = Core::Data::Ast::ExtraSlots::getId(idPrefix + S("autoDtor"));
+    this->idAutoDtorType = Core::Data::Ast::ExtraSlots::getId(idPrefix + S("autoDtorType"));
+    this->idCodeGenFailed = Core::Data::Ast::ExtraSlots::getId(idPrefix + S("codeGenFailed"));
+    this->idInitStatementGenIndex = Core::Data::Ast::ExtraSlots::getId(idPrefix + S("initStatementGenIndex"));
+
+    this->idBuildId = Core::Data::Ast::ExtraSlots::getId(sharedIdPrefix + S("buildId"));
+    this->idGlobalVarState = Core::Data::Ast::ExtraSlots::getId(sharedIdPrefix + S("globalVarState"));
+
+    this->sessionIds[0] = this->idCodeGenData;
+    this->sessionIds[1] = this->idAutoCtor;
+    this->sessionIds[2] = this->idAutoCtorType;
+    this->sessionIds[3] = this->idAutoDtor;
+    this->sessionIds[4] = this->idAutoDtorType;
+    this->sessionIds[5] = this->idCodeGenFailed;
+    this->sessionIds[6] = this->idInitStatementGenIndex;
+  }
+
+  /// Removes all the data this build session attached to the given object, except the shared data.
+  public: void removeSessionData(Core::Data::Ast::MetaHaving *object)
+  {
+    object->removeExtras(this->sessionIds, sizeof(this->sessionIds) / sizeof(this->sessionIds[0]));
   }
 
   DEFINE_EXTRA_ACCESSORS(CodeGenData);
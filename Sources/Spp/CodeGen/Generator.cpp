@@ -129,6 +129,10 @@ Bool Generator::_generateFunction(TiObject *self, Spp::Ast::Function *astFunc, S
   PREPARE_SELF(generator, Generator);
   auto generation = ti_cast<Generation>(generator);
 
+  // Intrinsics are generated at their call sites.
+  auto def = ti_cast<Core::Data::Ast::Definition>(astFunc->getOwner());
+  if (def != 0 && Ast::findIntrinsicModifier(def) != 0) return true;
+
   auto tgFunc = session->getEda()->tryGetCodeGenData<TiObject>(astFunc);
   if (tgFunc == 0) {
     if (!generation->generateFunctionDecl(astFunc, session)) return false;
@@ -1159,8 +1163,7 @@ Bool Generator::_buildDependencies(TiObject *self, Session *session)
 
   // Build function dependencies.
   while (session->getFuncDeps()->getCount() > 0) {
-    auto astFunc = static_cast<Ast::Function*>(session->getFuncDeps()->get(0));
-    session->getFuncDeps()->remove(0);
+    auto astFunc = session->getFuncDeps()->takeFirst();
     if (!generation->generateFunction(astFunc, session)) result = false;
   }
 
@@ -107,6 +107,11 @@ class TargetGeneration : public ObjTiInterface
       &this->generateGreaterThanOrEqual,
       &this->generateLessThan,
       &this->generateLessThanOrEqual,
+      &this->generateAtomicLoad,
+      &this->generateAtomicStore,
+      &this->generateAtomicRmw,
+      &this->generateAtomicCompareExchange,
+      &this->generateAtomicFence,
       &this->generateIntLiteral,
       &this->generateFloatLiteral,
       &this->generateStringLiteral,
@@ -611,6 +616,44 @@ class TargetGeneration : public ObjTiInterface
 
   /// @}
 
+  /// @name Atomic Ops Generation Functions
+  /// @{
+
+  public: METHOD_BINDING_CACHE(generateAtomicLoad,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, TiObject* /* srcRef */, TiObject* /* order */,
+      TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicStore,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, TiObject* /* srcVal */, TiObject* /* destRef */,
+      TiObject* /* order */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicRmw,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, AtomicRmwOperation /* operation */, TiObject* /* destRef */,
+      TiObject* /* srcVal */, TiObject* /* order */, TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicCompareExchange,
+    Bool, (
+      TiObject* /* context */, TiObject* /* type */, TiObject* /* destRef */, TiObject* /* expectedRef */,
+      TiObject* /* desiredVal */, TiObject* /* successOrder */, TiObject* /* failureOrder */,
+      TioSharedPtr& /* result */
+    )
+  );
+
+  public: METHOD_BINDING_CACHE(generateAtomicFence,
+    Bool, (TiObject* /* context */, TiObject* /* order */)
+  );
+
+  /// @}
+
   /// @name Literal Generation Functions
   /// @{
 
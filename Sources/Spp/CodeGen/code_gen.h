@@ -49,6 +49,18 @@ s_enum(GlobalVarState,
   TERMINATED = 8
 );
 
+/// Memory orders of atomic operations, numbered the same way as C11's memory_order.
+s_enum(MemoryOrder,
+  RELAXED = 0,
+  CONSUME = 1,
+  ACQUIRE = 2,
+  RELEASE = 3,
+  ACQ_REL = 4,
+  SEQ_CST = 5
+);
+
+s_enum(AtomicRmwOperation, EXCHANGE, ADD, SUB, AND, OR, XOR);
+
 
 //==============================================================================
 // Global Functions
@@ -57,26 +69,26 @@ s_enum(GlobalVarState,
 
 template <class DT, class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline DT* tryGetExtra(OT *object, Char const *name)
+inline DT* tryGetExtra(OT *object, Word id)
 {
-  return object->getExtra(name).template ti_cast_get<DT>();
+  return object->getExtra(id).template ti_cast_get<DT>();
 }
 
 template <class DT, class OT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline DT* tryGetExtra(OT *object, Char const *name)
+inline DT* tryGetExtra(OT *object, Word id)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) return 0;
-  return metadata->getExtra(name).template ti_cast_get<DT>();
+  return metadata->getExtra(id).template ti_cast_get<DT>();
 }
 
 // getExtra
 
 template <class DT, class OT>
-inline DT* getExtra(OT *object, Char const *name)
+inline DT* getExtra(OT *object, Word id)
 {
-  auto result = tryGetExtra<DT, OT>(object, name);
+  auto result = tryGetExtra<DT, OT>(object, id);
   if (result == 0) {
     throw EXCEPTION(GenericException, S("Object is missing the generated data."));
   }
@@ -87,72 +99,80 @@ inline DT* getExtra(OT *object, Char const *name)
 
 template <class DT, class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void setExtra(OT *object, Char const *name, SharedPtr<DT> const &data)
+inline void setExtra(OT *object, Word id, SharedPtr<DT> const &data)
 {
-  object->setExtra(name, data);
+  object->setExtra(id, data);
 }
 
 template <class DT, class OT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void setExtra(OT *object, Char const *name, SharedPtr<DT> const &data)
+inline void setExtra(OT *object, Word id, SharedPtr<DT> const &data)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->setExtra(name, data);
+  metadata->setExtra(id, data);
 }
 
 // removeExtra
 
 template <class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void removeExtra(OT *object, Char const *name)
+inline void removeExtra(OT *object, Word id)
 {
-  object->removeExtra(name);
+  object->removeExtra(id);
 }
 
 template <class OT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void removeExtra(OT *object, Char const *name)
+inline void removeExtra(OT *object, Word id)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->removeExtra(name);
+  metadata->removeExtra(id);
 }
 
 // Ast Related Accessors
 
+#define DEFINE_EXTRA_ID(name) \
+  inline Word get##name##ExtraId() { \
+    static Word id = Core::Data::Ast::ExtraSlots::getId(#name); return id; \
+  }
+
 #define DEFINE_FLAG_ACCESSORS(name) \
+  DEFINE_EXTRA_ID(name) \
   template <class OT> inline Bool is##name(OT *object) { \
-    auto f = tryGetExtra<TiBool>(object, #name); return f && f->get(); \
+    auto f = tryGetExtra<TiBool>(object, get##name##ExtraId()); return f && f->get(); \
   } \
   template <class OT> inline void set##name(OT *object, Bool f) { \
-    setExtra(object, #name, TiBool::create(f)); \
+    setExtra(object, get##name##ExtraId(), TiBool::create(f)); \
   } \
-  template <class OT> inline void reset##name(OT *object) { removeExtra(object, #name); }
+  template <class OT> inline void reset##name(OT *object) { removeExtra(object, get##name##ExtraId()); }
 
 #define DEFINE_STR_ACCESSORS(name) \
+  DEFINE_EXTRA_ID(name) \
   template <class OT> inline void set##name(OT *object, Str f) { \
-    setExtra(object, #name, TiStr::create(f)); \
+    setExtra(object, get##name##ExtraId(), TiStr::create(f)); \
   } \
   template <class OT> inline Str get##name(OT *object) { \
-    auto s = tryGetExtra<TiStr>(object, #name); return s != 0 ? s->getStr() : Str(); \
+    auto s = tryGetExtra<TiStr>(object, get##name##ExtraId()); return s != 0 ? s->getStr() : Str(); \
   } \
-  template <class OT> inline void reset##name(OT *object) { removeExtra(object, #name); }
+  template <class OT> inline void reset##name(OT *object) { removeExtra(object, get##name##ExtraId()); }
 
 DEFINE_FLAG_ACCESSORS(Executed);
 DEFINE_STR_ACCESSORS(MangledName);
 
 // Ast Processing State
+DEFINE_EXTRA_ID(AstProcessing);
 template <class OT> inline Int getAstProcessingState(OT *object) {
-  auto f = tryGetExtra<TiInt>(object, "AstProcessing");
+  auto f = tryGetExtra<TiInt>(object, getAstProcessingExtraId());
   return f ? f->get() : AstProcessingState::NOT_STARTED;
 }
 template <class OT> inline void setAstProcessingState(OT *object, Int s) {
-  setExtra(object, "AstProcessing", TiInt::create(s));
+  setExtra(object, getAstProcessingExtraId(), TiInt::create(s));
 }
 
 } // namespace
@@ -163,6 +183,7 @@ template <class OT> inline void setAstProcessingState(OT *object, Int s) {
 
 DEFINE_TYPE_NAME(Spp::CodeGen::GenResult, "alusus.org/Spp/Spp.CodeGen.GenResult");
 DEFINE_TYPE_NAME(Spp::CodeGen::TerminalStatement, "alusus.org/Spp/Spp.CodeGen.TerminalStatement");
+DEFINE_TYPE_NAME(Spp::CodeGen::AtomicRmwOperation, "alusus.org/Spp/Spp.CodeGen.AtomicRmwOperation");
 
 
 //==============================================================================
@@ -368,7 +368,8 @@ void SppFactory::createGrammar()
   this->set(S("root.Main.Function.modifierTranslations"), Map::create({}, {
     {S("تصدير"), TiStr::create(S("expname"))},
     {S("عضو"), TiStr::create(S("member"))},
-    {S("عملية"), TiStr::create(S("operation"))}
+    {S("عملية"), TiStr::create(S("operation"))},
+    {S("ضمني"), TiStr::create(S("intrinsic"))}
   }));
 
   // FuncSigExpression
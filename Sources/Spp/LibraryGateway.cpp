@@ -27,6 +27,44 @@ void LibraryGateway::initialize(Main::RootManager *manager)
   // Initialize type info for types that aren't initialized at the C++ side prior to being used on Alusus side.
   TiPtr::getTypeInfo();
   Ast::PreGenTransformStatement::getTypeInfo();
+  // AST cache entries refer to AST types by their unique names.
+  Ast::ArgPack::getTypeInfo();
+  Ast::ArrayType::getTypeInfo();
+  Ast::AstLiteralCommand::getTypeInfo();
+  Ast::AstRefOp::getTypeInfo();
+  Ast::Block::getTypeInfo();
+  Ast::BreakStatement::getTypeInfo();
+  Ast::CastOp::getTypeInfo();
+  Ast::ContentOp::getTypeInfo();
+  Ast::ContinueStatement::getTypeInfo();
+  Ast::DerefOp::getTypeInfo();
+  Ast::FloatType::getTypeInfo();
+  Ast::ForStatement::getTypeInfo();
+  Ast::Function::getTypeInfo();
+  Ast::FunctionType::getTypeInfo();
+  Ast::IfStatement::getTypeInfo();
+  Ast::InitOp::getTypeInfo();
+  Ast::IntegerType::getTypeInfo();
+  Ast::Macro::getTypeInfo();
+  Ast::Module::getTypeInfo();
+  Ast::NextArgOp::getTypeInfo();
+  Ast::NoDerefOp::getTypeInfo();
+  Ast::PointerOp::getTypeInfo();
+  Ast::PointerType::getTypeInfo();
+  Ast::PreprocessStatement::getTypeInfo();
+  Ast::ReferenceType::getTypeInfo();
+  Ast::ReturnStatement::getTypeInfo();
+  Ast::SizeOp::getTypeInfo();
+  Ast::Template::getTypeInfo();
+  Ast::TemplateVarDef::getTypeInfo();
+  Ast::TerminateOp::getTypeInfo();
+  Ast::ThisTypeRef::getTypeInfo();
+  Ast::TypeOp::getTypeInfo();
+  Ast::UseInOp::getTypeInfo();
+  Ast::UserType::getTypeInfo();
+  Ast::Variable::getTypeInfo();
+  Ast::VoidType::getTypeInfo();
+  Ast::WhileStatement::getTypeInfo();
 
   // Create AST helpers.
   this->nodePathResolver = newSrdObj<Ast::NodePathResolver>();
@@ -67,6 +105,16 @@ void LibraryGateway::initialize(Main::RootManager *manager)
     this->generator.get(),
     this->globalItemRepo.get()
   );
+  LlvmCodeGen::JitOptimizationLevel jitOptimizationLevel;
+  if (LlvmCodeGen::parseJitOptimizationLevel(manager->getJitOptimizationLevel().getBuf(), jitOptimizationLevel)) {
+    this->buildManager->setJitOptimizationLevel(jitOptimizationLevel);
+  }
+  this->buildManager->setJitOptimizationTimeReporting(manager->isJitOptimizationTimeReporting());
+  this->buildManager->setJitCacheDirectory(manager->getJitCacheDirectory().getBuf());
+  LlvmCodeGen::ProfileMode jitProfileMode;
+  if (LlvmCodeGen::parseProfileMode(manager->getJitProfileMode().getBuf(), jitProfileMode)) {
+    this->buildManager->setJitProfiling(jitProfileMode, manager->getJitProfileFilename().getBuf());
+  }
 
   this->astProcessor = newSrdObj<CodeGen::AstProcessor>(
     this->astHelper.get(),
@@ -21,8 +21,13 @@ void JitBuildTarget::setupBuild()
 
   this->llvmJitEngine.reset();
 
-  this->llvmJitEngine = llvm::cantFail(JitEngineBuilder().create(this->globalItemRepo));
+  this->llvmJitEngine = llvm::cantFail(
+    JitEngineBuilder().setObjectCache(this->objectCache).create(this->globalItemRepo)
+  );
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
+  this->llvmJitEngine->setOptimizationLevel(this->optimizationLevel);
+  this->llvmJitEngine->setOptimizationTimeReporting(this->optimizationTimeReporting);
+  this->llvmJitEngine->setProfiling(this->profileMode, this->profileFilename);
 
   this->llvmModule.reset();
 
@@ -68,12 +73,24 @@ void JitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
 
 void JitBuildTarget::execute(Char const *entry)
 {
+  typedef Core::Basic::PhaseStats::Phase Phase;
+  // The module is optimized while being materialized during the lookup, so the optimization time is excluded from
+  // the time recorded for linking.
+  auto optimizationTime = PHASE_STATS->getTime(Phase::OPTIMIZATION);
+  auto startTime = std::chrono::steady_clock::now();
+
   if (this->llvmModule != 0) this->addLlvmModule(std::move(this->llvmModule));
 
   typedef void (*FuncType)();
   auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
   auto funcPtr = (FuncType)llvmEntry.getAddress();
 
+  LongWord duration = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - startTime
+  ).count();
+  LongWord optimizationDuration = PHASE_STATS->getTime(Phase::OPTIMIZATION) - optimizationTime;
+  PHASE_STATS->add(Phase::JIT_LINKING, duration > optimizationDuration ? duration - optimizationDuration : 0);
+
   funcPtr();
 }
 
@@ -34,12 +34,18 @@ class JitBuildTarget : public BuildTarget
   private: std::unique_ptr<llvm::Module> llvmModule;
 
   private: CodeGen::GlobalItemRepo *globalItemRepo = 0;
+  private: JitObjectCache *objectCache = 0;
+
+  private: JitOptimizationLevel optimizationLevel = JitOptimizationLevel::O3;
+  private: Bool optimizationTimeReporting = false;
+  private: ProfileMode profileMode = ProfileMode::NONE;
+  private: Str profileFilename;
 
 
   //============================================================================
   // Constructors & Destructor
 
-  public: JitBuildTarget(CodeGen::GlobalItemRepo *gir) : globalItemRepo(gir)
+  public: JitBuildTarget(CodeGen::GlobalItemRepo *gir, JitObjectCache *cache = 0) : globalItemRepo(gir), objectCache(cache)
   {
   }
 
@@ -75,6 +81,44 @@ class JitBuildTarget : public BuildTarget
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module);
 
+  /// Set the optimization level of modules added from now on.
+  public: void setOptimizationLevel(JitOptimizationLevel level)
+  {
+    this->optimizationLevel = level;
+    if (this->llvmJitEngine != 0) this->llvmJitEngine->setOptimizationLevel(level);
+  }
+
+  public: JitOptimizationLevel getOptimizationLevel() const
+  {
+    return this->optimizationLevel;
+  }
+
+  /// Enable or disable printing the time spent optimizing each module.
+  public: void setOptimizationTimeReporting(Bool enabled)
+  {
+    this->optimizationTimeReporting = enabled;
+    if (this->llvmJitEngine != 0) this->llvmJitEngine->setOptimizationTimeReporting(enabled);
+  }
+
+  /// Set the profile guided optimization mode of modules added from now on.
+  public: void setProfiling(ProfileMode mode, Char const *filename)
+  {
+    if (this->profileMode == mode && this->profileFilename == (filename == 0 ? S("") : filename)) return;
+    this->profileMode = mode;
+    this->profileFilename = filename;
+    if (this->llvmJitEngine != 0) this->llvmJitEngine->setProfiling(mode, filename);
+  }
+
+  public: ProfileMode getProfileMode() const
+  {
+    return this->profileMode;
+  }
+
+  public: JitEngine* getJitEngine() const
+  {
+    return this->llvmJitEngine.get();
+  }
+
   public: void execute(Char const *entry);
 
 }; // class
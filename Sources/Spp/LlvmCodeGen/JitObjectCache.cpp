@@ -0,0 +1,142 @@
+/**
+ * @file Spp/LlvmCodeGen/JitObjectCache.cpp
+ * Contains the implementation of class Spp::LlvmCodeGen::JitObjectCache.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+
+namespace Spp::LlvmCodeGen
+{
+
+static Char const *keyPrefix = "alusus-jit-";
+
+
+//==============================================================================
+// Member Functions
+
+void JitObjectCache::setDirectory(Char const *dir)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->preloadedObjects.clear();
+  if (dir == 0 || dir[0] == 0) {
+    this->directory.clear();
+    return;
+  }
+  if (auto ec = llvm::sys::fs::create_directories(dir)) {
+    LOG(Spp::LogLevel::LLVMCODEGEN_DIAGNOSTIC, S("Could not create JIT cache directory: ") << ec.message().c_str());
+    this->directory.clear();
+    return;
+  }
+  this->directory = dir;
+}
+
+
+std::string JitObjectCache::computeKey(llvm::Module const &module, llvm::StringRef context)
+{
+  llvm::SmallVector<char, 0> bitcode;
+  {
+    llvm::raw_svector_ostream stream(bitcode);
+    llvm::WriteBitcodeToFile(module, stream);
+  }
+
+  llvm::SHA1 hasher;
+  hasher.update(context);
+  hasher.update(llvm::ArrayRef<uint8_t>(reinterpret_cast<uint8_t const*>(bitcode.data()), bitcode.size()));
+  return std::string(keyPrefix) + llvm::toHex(hasher.final(), true);
+}
+
+
+Bool JitObjectCache::isKey(llvm::StringRef id)
+{
+  return id.starts_with(keyPrefix);
+}
+
+
+Bool JitObjectCache::preload(std::string const &key)
+{
+  if (!this->isEnabled()) return false;
+  auto obj = this->loadObject(key);
+  if (obj == nullptr) return false;
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->preloadedObjects[key] = std::move(obj);
+  return true;
+}
+
+
+void JitObjectCache::notifyObjectCompiled(llvm::Module const *module, llvm::MemoryBufferRef obj)
+{
+  auto id = module->getModuleIdentifier();
+  if (!this->isEnabled() || !JitObjectCache::isKey(id)) return;
+
+  // Write into a temporary file then rename it so concurrent runs never see partially written objects.
+  auto path = this->getObjectPath(id);
+  int fd;
+  llvm::SmallString<256> tempPath;
+  if (llvm::sys::fs::createUniqueFile(path + ".tmp-%%%%%%", fd, tempPath)) return;
+  {
+    llvm::raw_fd_ostream stream(fd, true);
+    stream << obj.getBuffer();
+    if (stream.has_error()) {
+      stream.clear_error();
+      llvm::sys::fs::remove(tempPath);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(tempPath, path)) {
+    llvm::sys::fs::remove(tempPath);
+    return;
+  }
+  ++this->storeCount;
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::getObject(llvm::Module const *module)
+{
+  auto id = module->getModuleIdentifier();
+  if (!this->isEnabled() || !JitObjectCache::isKey(id)) return nullptr;
+
+  std::unique_ptr<llvm::MemoryBuffer> obj;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto iter = this->preloadedObjects.find(id);
+    if (iter != this->preloadedObjects.end()) {
+      obj = std::move(iter->second);
+      this->preloadedObjects.erase(iter);
+    }
+  }
+  if (obj == nullptr) obj = this->loadObject(id);
+
+  if (obj == nullptr) ++this->missCount;
+  else ++this->hitCount;
+  return obj;
+}
+
+
+std::string JitObjectCache::getObjectPath(llvm::StringRef id) const
+{
+  // Module identifiers derived from keys, like the ones of lazily compiled partitions, can have any character.
+  std::string filename = id.str();
+  for (auto &c : filename) {
+    if (!llvm::isAlnum(c) && c != '-' && c != '_' && c != '.') c = '_';
+  }
+  llvm::SmallString<256> path(this->directory);
+  llvm::sys::path::append(path, filename + ".o");
+  return std::string(path.str());
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::loadObject(llvm::StringRef id) const
+{
+  auto buffer = llvm::MemoryBuffer::getFile(this->getObjectPath(id), false, false);
+  if (!buffer) return nullptr;
+  return std::move(*buffer);
+}
+
+} // namespace
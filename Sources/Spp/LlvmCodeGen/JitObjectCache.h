@@ -0,0 +1,105 @@
+/**
+ * @file Spp/LlvmCodeGen/JitObjectCache.h
+ * Contains the header of class Spp::LlvmCodeGen::JitObjectCache.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_LLVMCODEGEN_JITOBJECTCACHE_H
+#define SPP_LLVMCODEGEN_JITOBJECTCACHE_H
+
+#include <mutex>
+
+namespace Spp::LlvmCodeGen
+{
+
+/**
+ * @brief An on-disk cache for the machine code of JIT compiled modules.
+ * @ingroup spp_llvmcodegen
+ *
+ * Modules are identified by a key computed from their unoptimized IR and the
+ * compilation settings. The JIT engine stores the key as the module identifier
+ * before compiling, and modules without such an identifier are not cached.
+ * The cache is disabled until a directory is set.
+ */
+class JitObjectCache : public llvm::ObjectCache
+{
+  //============================================================================
+  // Member Variables
+
+  private: std::string directory;
+
+  /// Objects loaded by preload() and not yet handed to the compiler.
+  private: std::unordered_map<std::string, std::unique_ptr<llvm::MemoryBuffer>> preloadedObjects;
+  private: std::mutex mutex;
+
+  private: std::atomic<Word> hitCount;
+  private: std::atomic<Word> missCount;
+  private: std::atomic<Word> storeCount;
+
+
+  //============================================================================
+  // Constructor
+
+  public: JitObjectCache() : hitCount(0), missCount(0), storeCount(0)
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Set the directory in which objects are stored, creating it if needed. An empty path disables the cache.
+  public: void setDirectory(Char const *dir);
+
+  public: std::string const& getDirectory() const
+  {
+    return this->directory;
+  }
+
+  public: Bool isEnabled() const
+  {
+    return !this->directory.empty();
+  }
+
+  /// Compute the cache key of a module. The context should describe everything that affects code generation.
+  public: static std::string computeKey(llvm::Module const &module, llvm::StringRef context);
+
+  public: static Bool isKey(llvm::StringRef id);
+
+  /// Load the object of the given key, if available, so that the next getObject() call is guaranteed to find it.
+  public: Bool preload(std::string const &key);
+
+  public: virtual void notifyObjectCompiled(llvm::Module const *module, llvm::MemoryBufferRef obj) override;
+
+  public: virtual std::unique_ptr<llvm::MemoryBuffer> getObject(llvm::Module const *module) override;
+
+  public: Word getHitCount() const
+  {
+    return this->hitCount;
+  }
+
+  public: Word getMissCount() const
+  {
+    return this->missCount;
+  }
+
+  public: Word getStoreCount() const
+  {
+    return this->storeCount;
+  }
+
+  private: std::string getObjectPath(llvm::StringRef id) const;
+
+  private: std::unique_ptr<llvm::MemoryBuffer> loadObject(llvm::StringRef id) const;
+
+}; // class
+
+} // namespace
+
+#endif
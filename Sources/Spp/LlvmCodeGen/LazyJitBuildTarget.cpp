@@ -21,8 +21,12 @@ void LazyJitBuildTarget::setupBuild()
 
   this->llvmJitEngine.reset();
 
-  this->llvmJitEngine = llvm::cantFail(LazyJitEngineBuilder().setNumCompileThreads(1).create(this->globalItemRepo));
+  this->llvmJitEngine = llvm::cantFail(
+    LazyJitEngineBuilder().setObjectCache(this->objectCache).setNumCompileThreads(1).create(this->globalItemRepo)
+  );
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
+  this->llvmJitEngine->setOptimizationLevel(this->optimizationLevel);
+  this->llvmJitEngine->setOptimizationTimeReporting(this->optimizationTimeReporting);
 
   this->llvmModule.reset();
 
@@ -68,12 +72,24 @@ void LazyJitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
 
 void LazyJitBuildTarget::execute(Char const *entry)
 {
+  typedef Core::Basic::PhaseStats::Phase Phase;
+  // The module is optimized while being materialized during the lookup, so the optimization time is excluded from
+  // the time recorded for linking.
+  auto optimizationTime = PHASE_STATS->getTime(Phase::OPTIMIZATION);
+  auto startTime = std::chrono::steady_clock::now();
+
   if (this->llvmModule != 0) this->addLlvmModule(std::move(this->llvmModule));
 
   typedef void (*FuncType)();
   auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
   auto funcPtr = (FuncType)llvmEntry.getAddress();
 
+  LongWord duration = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - startTime
+  ).count();
+  LongWord optimizationDuration = PHASE_STATS->getTime(Phase::OPTIMIZATION) - optimizationTime;
+  PHASE_STATS->add(Phase::JIT_LINKING, duration > optimizationDuration ? duration - optimizationDuration : 0);
+
   funcPtr();
 }
 
@@ -34,12 +34,16 @@ class LazyJitBuildTarget : public BuildTarget
   private: std::unique_ptr<llvm::Module> llvmModule;
 
   private: CodeGen::GlobalItemRepo *globalItemRepo = 0;
+  private: JitObjectCache *objectCache = 0;
+
+  private: JitOptimizationLevel optimizationLevel = JitOptimizationLevel::O3;
+  private: Bool optimizationTimeReporting = false;
 
 
   //============================================================================
   // Constructors & Destructor
 
-  public: LazyJitBuildTarget(CodeGen::GlobalItemRepo *gir) : globalItemRepo(gir)
+  public: LazyJitBuildTarget(CodeGen::GlobalItemRepo *gir, JitObjectCache *cache = 0) : globalItemRepo(gir), objectCache(cache)
   {
   }
 
@@ -75,6 +79,30 @@ class LazyJitBuildTarget : public BuildTarget
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module);
 
+  /// Set the optimization level of modules added from now on.
+  public: void setOptimizationLevel(JitOptimizationLevel level)
+  {
+    this->optimizationLevel = level;
+    if (this->llvmJitEngine != 0) this->llvmJitEngine->setOptimizationLevel(level);
+  }
+
+  public: JitOptimizationLevel getOptimizationLevel() const
+  {
+    return this->optimizationLevel;
+  }
+
+  /// Enable or disable printing the time spent optimizing each module.
+  public: void setOptimizationTimeReporting(Bool enabled)
+  {
+    this->optimizationTimeReporting = enabled;
+    if (this->llvmJitEngine != 0) this->llvmJitEngine->setOptimizationTimeReporting(enabled);
+  }
+
+  public: LazyJitEngine* getJitEngine() const
+  {
+    return this->llvmJitEngine.get();
+  }
+
   public: void execute(Char const *entry);
 
 }; // class
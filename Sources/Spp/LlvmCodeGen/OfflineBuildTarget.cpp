@@ -22,24 +22,7 @@ void OfflineBuildTarget::setupBuild()
   this->llvmGlobalCtorDtorEntryTypes = LlvmGlobalCtorDtorEntryTypes();
   this->llvmModule.reset();
 
-  std::string error;
-  auto target = llvm::TargetRegistry::lookupTarget(this->targetTriple, error);
-
-  // Print an error and exit if we couldn't find the requested target.
-  // This generally occurs if we've forgotten to initialise the
-  // TargetRegistry or we have a bogus target triple.
-  if (!target) {
-    throw EXCEPTION(GenericException, error.c_str());
-  }
-
-  auto cpu = "generic";
-  auto features = "";
-
-  llvm::TargetOptions opt;
-  auto rm = std::optional<llvm::Reloc::Model>();
-  this->targetMachine = std::unique_ptr<llvm::TargetMachine>(
-    target->createTargetMachine(targetTriple, cpu, features, opt, rm)
-  );
+  this->targetMachine = this->createTargetMachine(ObjectFileOptions());
 
   this->llvmDataLayout = std::make_unique<llvm::DataLayout>(this->targetMachine->createDataLayout());
 
@@ -98,17 +81,45 @@ Str OfflineBuildTarget::generateLlvmIr(Array<Str> const *ctorNames, Array<Str> c
 
 void OfflineBuildTarget::generateObjectFile(
   Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames
+) {
+  this->generateObjectFile(filename, ctorNames, dtorNames, ObjectFileOptions());
+}
+
+
+void OfflineBuildTarget::generateObjectFile(
+  Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames, ObjectFileOptions const &options
 ) {
   VALIDATE_NOT_NULL(filename);
+  if (options.optimizationLevel == JitOptimizationLevel::TIERED) {
+    throw EXCEPTION(InvalidArgumentException, S("options"), S("Tiered optimization is only available for JIT."));
+  }
 
   // Make sure the global llvm module exists.
   this->getGlobalLlvmModule();
 
+  this->llvmModule->setTargetTriple(this->targetTriple);
+
+  // The target machine created during setup targets a generic CPU, so create one for the requested CPU.
+  auto tm = this->createTargetMachine(options);
+
+  // Profiling is applied before the ctor and dtor arrays are built since instrumentation adds a dump function that
+  // needs to run at exit along with the other global destructors.
+  Array<Str> profiledDtorNames;
+  if (options.profileMode != ProfileMode::NONE) {
+    std::vector<std::string> dumpFunctionNames;
+    ProfileManager(options.profileMode, options.profileFilename).prepareModule(
+      *this->llvmModule, tm.get(), true, dumpFunctionNames
+    );
+    if (!dumpFunctionNames.empty()) {
+      if (dtorNames != 0) profiledDtorNames = *dtorNames;
+      for (auto const &name : dumpFunctionNames) profiledDtorNames.add(Str(name.c_str()));
+      dtorNames = &profiledDtorNames;
+    }
+  }
+
   this->buildCtorOrDtorArray(ctorNames, "llvm.global_ctors");
   this->buildCtorOrDtorArray(dtorNames, "llvm.global_dtors");
 
-  this->llvmModule->setTargetTriple(this->targetTriple);
-
   std::error_code ec;
   llvm::raw_fd_ostream dest(filename, ec, llvm::sys::fs::OF_None);
 
@@ -116,18 +127,243 @@ void OfflineBuildTarget::generateObjectFile(
     throw EXCEPTION(FileException, ec.message().c_str(), C('w'));
   }
 
-  llvm::legacy::PassManager pass;
-  auto fileType = llvm::CodeGenFileType::ObjectFile;
+  this->optimizeModule(tm.get(), options);
+
+  if (options.lto) {
+    this->runThinLto(tm.get(), dest, filename, options);
+  } else if (options.bitcode) {
+    auto summaryIndex = llvm::buildModuleSummaryIndex(*this->llvmModule, nullptr, nullptr);
+    llvm::WriteBitcodeToFile(*this->llvmModule, dest, false, &summaryIndex);
+  } else if (options.partitionCount > 1) {
+    // Split the module and emit the partitions in parallel, each on its own thread and within its own context.
+    std::vector<std::unique_ptr<llvm::raw_fd_ostream>> partitionStreams;
+    std::vector<llvm::raw_pwrite_stream*> outputs({ &dest });
+    for (Word i = 1; i < options.partitionCount; ++i) {
+      auto partitionFilename = OfflineBuildTarget::getPartitionFilename(filename, i);
+      partitionStreams.push_back(
+        std::make_unique<llvm::raw_fd_ostream>(partitionFilename.getBuf(), ec, llvm::sys::fs::OF_None)
+      );
+      if (ec) {
+        throw EXCEPTION(FileException, ec.message().c_str(), C('w'));
+      }
+      outputs.push_back(partitionStreams.back().get());
+    }
+    llvm::splitCodeGen(
+      *this->llvmModule, outputs, {}, [this, &options]() { return this->createTargetMachine(options); },
+      llvm::CodeGenFileType::ObjectFile
+    );
+  } else {
+    llvm::legacy::PassManager pass;
+    auto fileType = llvm::CodeGenFileType::ObjectFile;
+
+    if (tm->addPassesToEmitFile(pass, dest, nullptr, fileType)) {
+      throw EXCEPTION(GenericException, S("TheTargetMachine can't emit a file of this type"));
+    }
 
-  if (this->targetMachine->addPassesToEmitFile(pass, dest, nullptr, fileType)) {
-    throw EXCEPTION(GenericException, S("TheTargetMachine can't emit a file of this type"));
+    pass.run(*this->llvmModule);
   }
-
-  pass.run(*this->llvmModule);
   dest.flush();
 }
 
 
+Str OfflineBuildTarget::getPartitionFilename(Char const *filename, Word index)
+{
+  if (index == 0) return Str(filename);
+  Char const *ext = strrchr(filename, C('.'));
+  Char const *dirEnd = strrchr(filename, C('/'));
+  if (ext == 0 || (dirEnd != 0 && ext < dirEnd)) return Str(filename) + S("-") + static_cast<LongInt>(index);
+  return Str(filename, 0, ext - filename) + S("-") + static_cast<LongInt>(index) + ext;
+}
+
+
+std::unique_ptr<llvm::TargetMachine> OfflineBuildTarget::createTargetMachine(ObjectFileOptions const &options)
+{
+  std::string error;
+  auto target = llvm::TargetRegistry::lookupTarget(this->targetTriple, error);
+
+  // Print an error and exit if we couldn't find the requested target.
+  // This generally occurs if we've forgotten to initialise the
+  // TargetRegistry or we have a bogus target triple.
+  if (!target) {
+    throw EXCEPTION(GenericException, error.c_str());
+  }
+
+  std::string cpu = "generic";
+  llvm::SubtargetFeatures features;
+  if (options.cpu != 0 && compareStr(options.cpu, S("native")) == 0) {
+    cpu = llvm::sys::getHostCPUName().str();
+    llvm::StringMap<bool> hostFeatures;
+    if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+      for (auto const &feature : hostFeatures) features.AddFeature(feature.first(), feature.second);
+    }
+  } else if (options.cpu != 0 && options.cpu[0] != 0) {
+    cpu = options.cpu;
+  }
+  if (options.features != 0 && options.features[0] != 0) {
+    for (auto const &feature : llvm::SubtargetFeatures(options.features).getFeatures()) features.AddFeature(feature);
+  }
+
+  llvm::CodeGenOptLevel codeGenLevel;
+  switch (options.optimizationLevel.val) {
+    case JitOptimizationLevel::O0: codeGenLevel = llvm::CodeGenOptLevel::None; break;
+    case JitOptimizationLevel::O1: codeGenLevel = llvm::CodeGenOptLevel::Less; break;
+    case JitOptimizationLevel::O3: codeGenLevel = llvm::CodeGenOptLevel::Aggressive; break;
+    default: codeGenLevel = llvm::CodeGenOptLevel::Default; break;
+  }
+
+  llvm::TargetOptions opt;
+  auto rm = std::optional<llvm::Reloc::Model>();
+  return std::unique_ptr<llvm::TargetMachine>(
+    target->createTargetMachine(this->targetTriple, cpu, features.getString(), opt, rm, std::nullopt, codeGenLevel)
+  );
+}
+
+
+/**
+ * Runs the new pass manager's per module pipeline for the requested level on
+ * the module. When bitcode or LTO is requested the ThinLTO pre-link pipeline
+ * is used instead, leaving the rest of the optimization to the link step.
+ */
+void OfflineBuildTarget::optimizeModule(llvm::TargetMachine *tm, ObjectFileOptions const &options)
+{
+  llvm::PassBuilder passBuilder(tm);
+  llvm::LoopAnalysisManager lam;
+  llvm::FunctionAnalysisManager fam;
+  llvm::CGSCCAnalysisManager cgam;
+  llvm::ModuleAnalysisManager mam;
+  passBuilder.registerModuleAnalyses(mam);
+  passBuilder.registerCGSCCAnalyses(cgam);
+  passBuilder.registerFunctionAnalyses(fam);
+  passBuilder.registerLoopAnalyses(lam);
+  passBuilder.crossRegisterProxies(lam, fam, cgam, mam);
+
+  llvm::OptimizationLevel level;
+  switch (options.optimizationLevel.val) {
+    case JitOptimizationLevel::O0: level = llvm::OptimizationLevel::O0; break;
+    case JitOptimizationLevel::O1: level = llvm::OptimizationLevel::O1; break;
+    case JitOptimizationLevel::O2: level = llvm::OptimizationLevel::O2; break;
+    case JitOptimizationLevel::SIZE: level = llvm::OptimizationLevel::Os; break;
+    default: level = llvm::OptimizationLevel::O3; break;
+  }
+
+  llvm::ModulePassManager mpm;
+  Bool preLink = options.bitcode || options.lto;
+  if (level == llvm::OptimizationLevel::O0) {
+    mpm = passBuilder.buildO0DefaultPipeline(level, preLink);
+  } else if (preLink) {
+    mpm = passBuilder.buildThinLTOPreLinkDefaultPipeline(level);
+  } else {
+    mpm = passBuilder.buildPerModuleDefaultPipeline(level);
+  }
+  mpm.addPass(llvm::VerifierPass());
+  mpm.run(*this->llvmModule, mam);
+}
+
+
+/**
+ * Links the module with the given bitcode inputs using the in-process ThinLTO
+ * backend, which imports functions across the modules and compiles each of
+ * them on its own thread. The object file of the module itself is written to
+ * the given stream while the inputs' object files are written to the
+ * following partition files, in order.
+ */
+void OfflineBuildTarget::runThinLto(
+  llvm::TargetMachine *tm, llvm::raw_pwrite_stream &dest, Char const *filename, ObjectFileOptions const &options
+) {
+  // Serialize the module along with its summary so that it can be added to LTO like the rest of the inputs.
+  llvm::SmallVector<char, 0> moduleBuffer;
+  {
+    llvm::raw_svector_ostream stream(moduleBuffer);
+    auto summaryIndex = llvm::buildModuleSummaryIndex(*this->llvmModule, nullptr, nullptr);
+    llvm::WriteBitcodeToFile(*this->llvmModule, stream, false, &summaryIndex);
+  }
+
+  // The input buffers need to stay alive until LTO is done.
+  std::vector<std::unique_ptr<llvm::MemoryBuffer>> inputBuffers;
+  std::vector<llvm::MemoryBufferRef> inputs({
+    llvm::MemoryBufferRef(llvm::StringRef(moduleBuffer.data(), moduleBuffer.size()), this->llvmModule->getName())
+  });
+  if (options.ltoInputs != 0) {
+    for (Int i = 0; i < options.ltoInputs->getLength(); ++i) {
+      Char const *inputFilename = options.ltoInputs->at(i).getBuf();
+      auto buffer = llvm::MemoryBuffer::getFile(inputFilename);
+      if (!buffer) {
+        throw EXCEPTION(FileException, inputFilename, C('r'), buffer.getError().message().c_str());
+      }
+      inputs.push_back((*buffer)->getMemBufferRef());
+      inputBuffers.push_back(std::move(*buffer));
+    }
+  }
+
+  llvm::lto::Config config;
+  config.CPU = tm->getTargetCPU().str();
+  config.MAttrs = llvm::SubtargetFeatures(tm->getTargetFeatureString()).getFeatures();
+  config.Options = tm->Options;
+  config.RelocModel = tm->getRelocationModel();
+  config.CGOptLevel = tm->getOptLevel();
+  config.DefaultTriple = this->targetTriple;
+  switch (options.optimizationLevel.val) {
+    case JitOptimizationLevel::O0: config.OptLevel = 0; break;
+    case JitOptimizationLevel::O1: config.OptLevel = 1; break;
+    case JitOptimizationLevel::O3: config.OptLevel = 3; break;
+    default: config.OptLevel = 2; break;
+  }
+
+  llvm::lto::LTO lto(
+    std::move(config), llvm::lto::createInProcessThinBackend(llvm::heavyweight_hardware_concurrency())
+  );
+
+  llvm::StringSet<> definedSymbols;
+  for (auto const &input : inputs) {
+    // Modules without a summary would go through regular LTO instead, which isn't supported here.
+    auto ltoInfo = llvm::getBitcodeLTOInfo(input);
+    if (!ltoInfo || !ltoInfo->HasSummary) {
+      Str message = S("LTO input is not a bitcode file with a summary: ");
+      message += input.getBufferIdentifier().str().c_str();
+      throw EXCEPTION(GenericException, message.getBuf());
+    }
+    auto file = llvm::lto::InputFile::create(input);
+    if (!file) {
+      throw EXCEPTION(GenericException, llvm::toString(file.takeError()).c_str());
+    }
+    std::vector<llvm::lto::SymbolResolution> resolutions;
+    for (auto const &symbol : (*file)->symbols()) {
+      llvm::lto::SymbolResolution resolution;
+      if (!symbol.isUndefined()) {
+        // The first definition of a symbol prevails, like it would with a regular linker.
+        resolution.Prevailing = definedSymbols.insert(symbol.getName()).second;
+        resolution.FinalDefinitionInLinkageUnit = resolution.Prevailing;
+      }
+      // The objects and libraries linked with the result may reference any of the symbols.
+      resolution.VisibleToRegularObj = true;
+      resolutions.push_back(resolution);
+    }
+    if (auto error = lto.add(std::move(*file), resolutions)) {
+      throw EXCEPTION(GenericException, llvm::toString(std::move(error)).c_str());
+    }
+  }
+
+  // Task 0 is reserved for regular LTO, which has nothing to generate since all the inputs have summaries, so
+  // ThinLTO modules start at task 1 in the same order as the inputs.
+  auto addStream = [&dest, filename](
+    unsigned task, llvm::Twine const &moduleName
+  ) -> llvm::Expected<std::unique_ptr<llvm::CachedFileStream>> {
+    if (task <= 1) {
+      return std::make_unique<llvm::CachedFileStream>(std::make_unique<llvm::buffer_ostream>(dest));
+    }
+    std::error_code ec;
+    auto stream = std::make_unique<llvm::raw_fd_ostream>(
+      OfflineBuildTarget::getPartitionFilename(filename, task - 1).getBuf(), ec, llvm::sys::fs::OF_None
+    );
+    if (ec) return llvm::errorCodeToError(ec);
+    return std::make_unique<llvm::CachedFileStream>(std::move(stream));
+  };
+  if (auto error = lto.run(addStream)) {
+    throw EXCEPTION(GenericException, llvm::toString(std::move(error)).c_str());
+  }
+}
+
+
 void OfflineBuildTarget::buildCtorOrDtorArray(Array<Str> const *funcNames, Char const *globalVarName)
 {
   // Make sure the global llvm module exists.
@@ -27,6 +27,50 @@ class OfflineBuildTarget : public BuildTarget
   //============================================================================
   // Types
 
+  /**
+   * @brief Options that control the generation of object files.
+   *
+   * The optimization level accepts the same values as the JIT optimization
+   * level except TIERED. The CPU can be set to "native" to target the CPU
+   * of the host, in which case the host's features are enabled as well. The
+   * given features, if any, are comma separated LLVM feature strings like
+   * "+avx2,-sse4a" and are added on top of the host's features. When
+   * bitcode is enabled the file will contain LLVM bitcode optimized for a
+   * later link time optimization rather than machine code, along with a
+   * ThinLTO module summary.
+   *
+   * When LTO is enabled the module is optimized for link time optimization
+   * and then linked in-process with the given bitcode inputs, which must
+   * have been generated with bitcode enabled, using ThinLTO. Functions are
+   * imported and inlined across all these modules before machine code is
+   * generated. Each module results in its own object file, named by
+   * getPartitionFilename in the same order as the inputs, starting with the
+   * program's own module. The partition count is ignored in this mode.
+   *
+   * If the partition count is more than 1 the optimized module is split into
+   * that many partitions, which are compiled in parallel into separate object
+   * files named by getPartitionFilename. Partitioning is ignored when
+   * generating bitcode.
+   *
+   * The profile mode and filename control profile guided optimization. In
+   * GENERATE mode the program is instrumented with counters that are
+   * appended to the profile file by a global destructor when the program
+   * exits. In USE mode the profile is applied to the module before it's
+   * optimized. The same profile file can be used for JIT and offline builds.
+   */
+  public: struct ObjectFileOptions
+  {
+    JitOptimizationLevel optimizationLevel = JitOptimizationLevel::O0;
+    Char const *cpu = 0;
+    Char const *features = 0;
+    Bool bitcode = false;
+    Word partitionCount = 1;
+    Bool lto = false;
+    Array<String> const *ltoInputs = 0;
+    ProfileMode profileMode = ProfileMode::NONE;
+    Char const *profileFilename = 0;
+  };
+
   private: struct LlvmGlobalCtorDtorEntryTypes
   {
     llvm::PointerType *llvmFuncPtrType = 0;
@@ -102,10 +146,40 @@ class OfflineBuildTarget : public BuildTarget
     Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames
   );
 
+  public: void generateObjectFile(
+    Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames, ObjectFileOptions const &options
+  );
+
+  /**
+   * @brief Get the name of the object file of the given partition.
+   *
+   * The first partition is written to the requested file itself. The rest
+   * get the partition index appended to the file's name before the
+   * extension, e.g. output-1.o, output-2.o, etc.
+   */
+  public: static Str getPartitionFilename(Char const *filename, Word index);
+
+  private: std::unique_ptr<llvm::TargetMachine> createTargetMachine(ObjectFileOptions const &options);
+
+  private: void optimizeModule(llvm::TargetMachine *tm, ObjectFileOptions const &options);
+
+  private: void runThinLto(
+    llvm::TargetMachine *tm, llvm::raw_pwrite_stream &dest, Char const *filename, ObjectFileOptions const &options
+  );
+
   private: void buildCtorOrDtorArray(Array<Str> const *funcNames, Char const *globalVarName);
 
 }; // class
 
 } // namespace
 
+
+//==============================================================================
+// Type Names
+
+DEFINE_TYPE_NAME(
+  Spp::LlvmCodeGen::OfflineBuildTarget::ObjectFileOptions,
+  "alusus.org/Spp/Spp.LlvmCodeGen.OfflineBuildTarget.ObjectFileOptions"
+);
+
 #endif
@@ -0,0 +1,248 @@
+/**
+ * @file Spp/LlvmCodeGen/ProfileManager.cpp
+ * Contains the implementation of class Spp::LlvmCodeGen::ProfileManager.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+
+namespace Spp::LlvmCodeGen
+{
+
+std::atomic<Word> ProfileManager::dumpFunctionCounter(0);
+
+
+//==============================================================================
+// Constructor
+
+ProfileManager::ProfileManager(ProfileMode m, Char const *fn) : mode(m)
+{
+  if (this->mode != ProfileMode::NONE) {
+    if (fn == 0 || fn[0] == 0) {
+      throw EXCEPTION(InvalidArgumentException, S("fn"), S("A profile filename is required."));
+    }
+    this->filename = fn;
+  }
+  if (this->mode == ProfileMode::USE) this->loadProfile();
+}
+
+
+//==============================================================================
+// Member Functions
+
+void ProfileManager::prepareModule(
+  llvm::Module &module, llvm::TargetMachine *tm, Bool internalDumpFunctions,
+  std::vector<std::string> &dumpFunctionNames
+) {
+  if (this->mode == ProfileMode::NONE) return;
+
+  llvm::PassBuilder passBuilder(tm);
+  llvm::LoopAnalysisManager lam;
+  llvm::FunctionAnalysisManager fam;
+  llvm::CGSCCAnalysisManager cgam;
+  llvm::ModuleAnalysisManager mam;
+  passBuilder.registerModuleAnalyses(mam);
+  passBuilder.registerCGSCCAnalyses(cgam);
+  passBuilder.registerFunctionAnalyses(fam);
+  passBuilder.registerLoopAnalyses(lam);
+  passBuilder.crossRegisterProxies(lam, fam, cgam, mam);
+
+  llvm::ModulePassManager mpm;
+  if (this->mode == ProfileMode::GENERATE) {
+    mpm.addPass(llvm::PGOInstrumentationGen());
+    mpm.addPass(CounterLowering(this, internalDumpFunctions, &dumpFunctionNames));
+  } else {
+    mpm.addPass(llvm::PGOInstrumentationUse(this->profilePath, "", false, this->profileFileSystem));
+  }
+  mpm.run(module, mam);
+}
+
+
+void ProfileManager::loadProfile()
+{
+  auto buffer = llvm::MemoryBuffer::getFile(this->filename);
+  if (!buffer) {
+    throw EXCEPTION(FileException, this->filename.c_str(), C('r'), buffer.getError().message().c_str());
+  }
+  if (llvm::IndexedInstrProfReader::hasFormat(**buffer)) {
+    this->profileFileSystem = llvm::vfs::getRealFileSystem();
+    this->profilePath = this->filename;
+    return;
+  }
+
+  // The instrumentation only reads indexed profiles, so text profiles, like the ones we generate, are merged into an
+  // indexed profile in memory. Records of the same function from different runs are summed up in the process.
+  auto reader = llvm::InstrProfReader::create(std::move(*buffer));
+  if (!reader) {
+    throw EXCEPTION(GenericException, llvm::toString(reader.takeError()).c_str());
+  }
+  llvm::InstrProfWriter writer;
+  if (auto error = writer.mergeProfileKind((*reader)->getProfileKind())) {
+    throw EXCEPTION(GenericException, llvm::toString(std::move(error)).c_str());
+  }
+  for (auto &record : **reader) {
+    writer.addRecord(std::move(record), [](llvm::Error error) { llvm::consumeError(std::move(error)); });
+  }
+  if ((*reader)->hasError()) {
+    throw EXCEPTION(GenericException, llvm::toString((*reader)->getError()).c_str());
+  }
+
+  auto fileSystem = llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+  this->profilePath = "/profile.profdata";
+  fileSystem->addFile(this->profilePath, 0, writer.writeBuffer());
+  this->profileFileSystem = fileSystem;
+}
+
+
+llvm::PreservedAnalyses ProfileManager::CounterLowering::run(
+  llvm::Module &module, llvm::ModuleAnalysisManager &mam
+) {
+  auto int64Type = llvm::Type::getInt64Ty(module.getContext());
+
+  std::vector<std::string> names;
+  std::vector<uint64_t> hashes;
+  std::vector<llvm::GlobalVariable*> counters;
+  std::unordered_map<llvm::GlobalVariable*, Word> counterIndexes;
+  std::vector<llvm::Instruction*> deadInsts;
+
+  for (auto &func : module) {
+    for (auto &block : func) {
+      for (auto &inst : block) {
+        auto intrinsic = llvm::dyn_cast<llvm::IntrinsicInst>(&inst);
+        if (intrinsic == 0 || !intrinsic->getCalledFunction()->getName().starts_with("llvm.instrprof.")) continue;
+        deadInsts.push_back(intrinsic);
+        // Anything other than counters, like value profiling, is dropped.
+        auto increment = llvm::dyn_cast<llvm::InstrProfIncrementInst>(intrinsic);
+        if (increment == 0) continue;
+
+        auto nameVar = increment->getName();
+        auto it = counterIndexes.find(nameVar);
+        Word index;
+        if (it == counterIndexes.end()) {
+          auto name = llvm::getPGOFuncNameVarInitializer(nameVar).str();
+          auto arrayType = llvm::ArrayType::get(int64Type, increment->getNumCounters()->getZExtValue());
+          index = counters.size();
+          counters.push_back(new llvm::GlobalVariable(
+            module, arrayType, false, llvm::GlobalValue::PrivateLinkage, llvm::ConstantAggregateZero::get(arrayType),
+            "__alusus_profc_" + name
+          ));
+          names.push_back(name);
+          hashes.push_back(increment->getHash()->getZExtValue());
+          counterIndexes[nameVar] = index;
+        } else {
+          index = it->second;
+        }
+
+        llvm::IRBuilder<> builder(increment);
+        auto counter = builder.CreateConstInBoundsGEP2_32(
+          counters[index]->getValueType(), counters[index], 0, increment->getIndex()->getZExtValue()
+        );
+        auto value = builder.CreateLoad(int64Type, counter);
+        builder.CreateStore(builder.CreateAdd(value, increment->getStep()), counter);
+      }
+    }
+  }
+
+  for (auto inst : deadInsts) inst->eraseFromParent();
+  for (auto const &entry : counterIndexes) {
+    if (entry.first->use_empty()) entry.first->eraseFromParent();
+  }
+  // Only needed by LLVM's profile runtime.
+  if (auto versionVar = module.getNamedGlobal("__llvm_profile_raw_version")) versionVar->eraseFromParent();
+
+  if (counters.empty()) return llvm::PreservedAnalyses::none();
+
+  auto dumpFunction = this->manager->generateDumpFunction(
+    module, this->internalDumpFunction, names, hashes, counters
+  );
+  this->dumpFunctionNames->push_back(dumpFunction->getName().str());
+  return llvm::PreservedAnalyses::none();
+}
+
+
+/**
+ * The generated function appends the counters to the profile file in LLVM's
+ * text format, writing the header first if the file is empty, then resets
+ * the counters so that calling it again doesn't count them twice.
+ */
+llvm::Function* ProfileManager::generateDumpFunction(
+  llvm::Module &module, Bool internal, std::vector<std::string> const &names, std::vector<uint64_t> const &hashes,
+  std::vector<llvm::GlobalVariable*> const &counters
+) {
+  auto &context = module.getContext();
+  auto voidType = llvm::Type::getVoidTy(context);
+  auto ptrType = llvm::PointerType::getUnqual(context);
+  auto intType = llvm::Type::getInt32Ty(context);
+  auto int64Type = llvm::Type::getInt64Ty(context);
+  auto longType = module.getDataLayout().getIntPtrType(context);
+
+  auto fopenFunc = module.getOrInsertFunction("fopen", llvm::FunctionType::get(ptrType, { ptrType, ptrType }, false));
+  auto fseekFunc = module.getOrInsertFunction(
+    "fseek", llvm::FunctionType::get(intType, { ptrType, longType, intType }, false)
+  );
+  auto ftellFunc = module.getOrInsertFunction("ftell", llvm::FunctionType::get(longType, { ptrType }, false));
+  auto fputsFunc = module.getOrInsertFunction("fputs", llvm::FunctionType::get(intType, { ptrType, ptrType }, false));
+  auto fprintfFunc = module.getOrInsertFunction(
+    "fprintf", llvm::FunctionType::get(intType, { ptrType, ptrType }, true)
+  );
+  auto fcloseFunc = module.getOrInsertFunction("fclose", llvm::FunctionType::get(intType, { ptrType }, false));
+
+  auto func = llvm::Function::Create(
+    llvm::FunctionType::get(voidType, false),
+    internal ? llvm::GlobalValue::InternalLinkage : llvm::GlobalValue::ExternalLinkage,
+    "__alusus_profile_dump_" + std::to_string(ProfileManager::dumpFunctionCounter++), module
+  );
+  auto entryBlock = llvm::BasicBlock::Create(context, "entry", func);
+  auto headerBlock = llvm::BasicBlock::Create(context, "header", func);
+  auto recordsBlock = llvm::BasicBlock::Create(context, "records", func);
+  auto doneBlock = llvm::BasicBlock::Create(context, "done", func);
+  auto openedBlock = llvm::BasicBlock::Create(context, "opened", func, headerBlock);
+
+  llvm::IRBuilder<> builder(entryBlock);
+  auto file = builder.CreateCall(
+    fopenFunc, { builder.CreateGlobalStringPtr(this->filename), builder.CreateGlobalStringPtr("a") }
+  );
+  builder.CreateCondBr(builder.CreateIsNull(file), doneBlock, openedBlock);
+
+  builder.SetInsertPoint(openedBlock);
+  builder.CreateCall(fseekFunc, { file, llvm::ConstantInt::get(longType, 0), llvm::ConstantInt::get(intType, SEEK_END) });
+  auto position = builder.CreateCall(ftellFunc, { file });
+  builder.CreateCondBr(builder.CreateICmpEQ(position, llvm::ConstantInt::get(longType, 0)), headerBlock, recordsBlock);
+
+  builder.SetInsertPoint(headerBlock);
+  builder.CreateCall(fputsFunc, { builder.CreateGlobalStringPtr("# IR level Instrumentation Flag\n:ir\n"), file });
+  builder.CreateBr(recordsBlock);
+
+  builder.SetInsertPoint(recordsBlock);
+  auto recordFormat = builder.CreateGlobalStringPtr("%s\n# Func Hash:\n%llu\n# Num Counters:\n%u\n# Counter Values:\n");
+  auto counterFormat = builder.CreateGlobalStringPtr("%llu\n");
+  auto separator = builder.CreateGlobalStringPtr("\n");
+  for (Word i = 0; i < counters.size(); ++i) {
+    auto arrayType = llvm::cast<llvm::ArrayType>(counters[i]->getValueType());
+    builder.CreateCall(fprintfFunc, {
+      file, recordFormat, builder.CreateGlobalStringPtr(names[i]), llvm::ConstantInt::get(int64Type, hashes[i]),
+      llvm::ConstantInt::get(intType, arrayType->getNumElements())
+    });
+    for (Word j = 0; j < arrayType->getNumElements(); ++j) {
+      auto counter = builder.CreateConstInBoundsGEP2_32(arrayType, counters[i], 0, j);
+      builder.CreateCall(fprintfFunc, { file, counterFormat, builder.CreateLoad(int64Type, counter) });
+      builder.CreateStore(llvm::ConstantInt::get(int64Type, 0), counter);
+    }
+    builder.CreateCall(fputsFunc, { separator, file });
+  }
+  builder.CreateCall(fcloseFunc, { file });
+  builder.CreateBr(doneBlock);
+
+  builder.SetInsertPoint(doneBlock);
+  builder.CreateRetVoid();
+
+  return func;
+}
+
+} // namespace
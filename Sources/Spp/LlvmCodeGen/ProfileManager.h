@@ -0,0 +1,116 @@
+/**
+ * @file Spp/LlvmCodeGen/ProfileManager.h
+ * Contains the header of class Spp::LlvmCodeGen::ProfileManager.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_LLVMCODEGEN_PROFILEMANAGER_H
+#define SPP_LLVMCODEGEN_PROFILEMANAGER_H
+
+namespace Spp::LlvmCodeGen
+{
+
+/**
+ * @brief Prepares modules for profile guided optimization.
+ * @ingroup spp_llvmcodegen
+ *
+ * In GENERATE mode functions are instrumented with LLVM's IR level profile
+ * counters before being optimized. Rather than relying on LLVM's profile
+ * runtime, which isn't available to JIT code, the counters are lowered into
+ * plain globals and each module gets a dump function that appends the
+ * module's counters to the profile file in LLVM's text profile format. The
+ * caller is responsible for calling the dump functions when the program
+ * exits. Profiles of multiple runs accumulate in the same file.
+ *
+ * In USE mode the given profile, either in text format or an indexed profile
+ * merged by llvm-profdata, is loaded once and its counts are attached to the
+ * functions of each module as branch weights and entry counts, which then
+ * drive inlining, block placement, and the rest of the optimization pipeline.
+ *
+ * Modules are prepared before any optimization in both modes so that the
+ * control flow hashes of the functions match between the two.
+ */
+class ProfileManager
+{
+  //============================================================================
+  // Types
+
+  /// A pass that lowers the profile intrinsics inserted by LLVM's instrumentation into plain counters.
+  private: class CounterLowering : public llvm::PassInfoMixin<CounterLowering>
+  {
+    private: ProfileManager *manager;
+    private: Bool internalDumpFunction;
+    private: std::vector<std::string> *dumpFunctionNames;
+
+    public: CounterLowering(ProfileManager *m, Bool internal, std::vector<std::string> *names) :
+      manager(m), internalDumpFunction(internal), dumpFunctionNames(names)
+    {
+    }
+
+    public: llvm::PreservedAnalyses run(llvm::Module &module, llvm::ModuleAnalysisManager &mam);
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: ProfileMode mode;
+  private: std::string filename;
+
+  /// The file system from which the profile is read in USE mode, which holds an indexed copy of text profiles.
+  private: llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> profileFileSystem;
+  private: std::string profilePath;
+
+  private: static std::atomic<Word> dumpFunctionCounter;
+
+
+  //============================================================================
+  // Constructor
+
+  public: ProfileManager(ProfileMode m, Char const *fn);
+
+
+  //============================================================================
+  // Member Functions
+
+  public: ProfileMode getMode() const
+  {
+    return this->mode;
+  }
+
+  public: std::string const& getFilename() const
+  {
+    return this->filename;
+  }
+
+  /**
+   * @brief Instrument the module or attach the profile to it depending on the mode.
+   *
+   * The names of the dump functions generated in GENERATE mode are added to
+   * the given array. Internal dump functions are meant to be referenced from
+   * within the same module, like from its global destructors, while the
+   * others are meant to be looked up by name.
+   */
+  public: void prepareModule(
+    llvm::Module &module, llvm::TargetMachine *tm, Bool internalDumpFunctions,
+    std::vector<std::string> &dumpFunctionNames
+  );
+
+  private: void loadProfile();
+
+  private: llvm::Function* generateDumpFunction(
+    llvm::Module &module, Bool internal, std::vector<std::string> const &names, std::vector<uint64_t> const &hashes,
+    std::vector<llvm::GlobalVariable*> const &counters
+  );
+
+}; // class
+
+} // namespace
+
+#endif
@@ -111,6 +111,13 @@ void TargetGenerator::initBindings()
   targetGeneration->generateLessThan = &TargetGenerator::generateLessThan;
   targetGeneration->generateLessThanOrEqual = &TargetGenerator::generateLessThanOrEqual;
 
+  // Atomic Ops Generation Functions
+  targetGeneration->generateAtomicLoad = &TargetGenerator::generateAtomicLoad;
+  targetGeneration->generateAtomicStore = &TargetGenerator::generateAtomicStore;
+  targetGeneration->generateAtomicRmw = &TargetGenerator::generateAtomicRmw;
+  targetGeneration->generateAtomicCompareExchange = &TargetGenerator::generateAtomicCompareExchange;
+  targetGeneration->generateAtomicFence = &TargetGenerator::generateAtomicFence;
+
   // Literal Generation Functions
   targetGeneration->generateIntLiteral = &TargetGenerator::generateIntLiteral;
   targetGeneration->generateFloatLiteral = &TargetGenerator::generateFloatLiteral;
@@ -2364,6 +2371,176 @@ Bool TargetGenerator::generateLessThanOrEqual(
 }
 
 
+//==============================================================================
+// Atomic Ops Generation Functions
+
+// The LLVM orderings of each operation, indexed by CodeGen::MemoryOrder. Orders that are invalid for an operation
+// are mapped the same way Clang maps them.
+
+static llvm::AtomicOrdering const atomicLoadOrderings[] = {
+  llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Acquire, llvm::AtomicOrdering::Acquire,
+  llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::SequentiallyConsistent
+};
+
+static llvm::AtomicOrdering const atomicStoreOrderings[] = {
+  llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Monotonic,
+  llvm::AtomicOrdering::Release, llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::SequentiallyConsistent
+};
+
+static llvm::AtomicOrdering const atomicRmwOrderings[] = {
+  llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Acquire, llvm::AtomicOrdering::Acquire,
+  llvm::AtomicOrdering::Release, llvm::AtomicOrdering::AcquireRelease, llvm::AtomicOrdering::SequentiallyConsistent
+};
+
+static llvm::AtomicOrdering const atomicFailureOrderings[] = {
+  llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Acquire, llvm::AtomicOrdering::Acquire,
+  llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Acquire, llvm::AtomicOrdering::SequentiallyConsistent
+};
+
+
+Bool TargetGenerator::generateAtomicLoad(
+  TiObject *context, TiObject *type, TiObject *srcRef, TiObject *order, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(srcRef, srcRefBox, Value);
+  PREPARE_ARG(order, orderBox, Value);
+
+  auto align = this->buildTarget->getLlvmDataLayout()->getABITypeAlign(tgType->getLlvmType());
+  auto llvmResult = this->generateAtomicOrderSwitch(
+    block, orderBox->getLlvmValue(), atomicLoadOrderings, [=](llvm::AtomicOrdering ordering)->llvm::Value* {
+      auto loadInst = block->getIrBuilder()->CreateLoad(tgType->getLlvmType(), srcRefBox->getLlvmValue());
+      loadInst->setAlignment(align);
+      loadInst->setAtomic(ordering);
+      return loadInst;
+    }
+  );
+
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicStore(
+  TiObject *context, TiObject *type, TiObject *srcVal, TiObject *destRef, TiObject *order
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  PREPARE_ARG(order, orderBox, Value);
+
+  auto align = this->buildTarget->getLlvmDataLayout()->getABITypeAlign(tgType->getLlvmType());
+  this->generateAtomicOrderSwitch(
+    block, orderBox->getLlvmValue(), atomicStoreOrderings, [=](llvm::AtomicOrdering ordering)->llvm::Value* {
+      auto storeInst = block->getIrBuilder()->CreateStore(srcValBox->getLlvmValue(), destRefBox->getLlvmValue());
+      storeInst->setAlignment(align);
+      storeInst->setAtomic(ordering);
+      return 0;
+    }
+  );
+
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicRmw(
+  TiObject *context, TiObject *type, CodeGen::AtomicRmwOperation operation, TiObject *destRef,
+  TiObject *srcVal, TiObject *order, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  PREPARE_ARG(srcVal, srcValBox, Value);
+  PREPARE_ARG(order, orderBox, Value);
+
+  llvm::AtomicRMWInst::BinOp llvmOp;
+  switch (operation.val) {
+    case CodeGen::AtomicRmwOperation::EXCHANGE: llvmOp = llvm::AtomicRMWInst::Xchg; break;
+    case CodeGen::AtomicRmwOperation::ADD: llvmOp = llvm::AtomicRMWInst::Add; break;
+    case CodeGen::AtomicRmwOperation::SUB: llvmOp = llvm::AtomicRMWInst::Sub; break;
+    case CodeGen::AtomicRmwOperation::AND: llvmOp = llvm::AtomicRMWInst::And; break;
+    case CodeGen::AtomicRmwOperation::OR: llvmOp = llvm::AtomicRMWInst::Or; break;
+    case CodeGen::AtomicRmwOperation::XOR: llvmOp = llvm::AtomicRMWInst::Xor; break;
+    default:
+      throw EXCEPTION(InvalidArgumentException, S("operation"), S("Unknown atomic operation."));
+  }
+
+  auto align = this->buildTarget->getLlvmDataLayout()->getABITypeAlign(tgType->getLlvmType());
+  auto llvmResult = this->generateAtomicOrderSwitch(
+    block, orderBox->getLlvmValue(), atomicRmwOrderings, [=](llvm::AtomicOrdering ordering)->llvm::Value* {
+      return block->getIrBuilder()->CreateAtomicRMW(
+        llvmOp, destRefBox->getLlvmValue(), srcValBox->getLlvmValue(), align, ordering
+      );
+    }
+  );
+
+  result = newSrdObj<Value>(llvmResult, false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicCompareExchange(
+  TiObject *context, TiObject *type, TiObject *destRef, TiObject *expectedRef, TiObject *desiredVal,
+  TiObject *successOrder, TiObject *failureOrder, TioSharedPtr &result
+) {
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(type, tgType, Type);
+  PREPARE_ARG(destRef, destRefBox, Value);
+  PREPARE_ARG(expectedRef, expectedRefBox, Value);
+  PREPARE_ARG(desiredVal, desiredValBox, Value);
+  PREPARE_ARG(successOrder, successOrderBox, Value);
+  PREPARE_ARG(failureOrder, failureOrderBox, Value);
+
+  auto builder = block->getIrBuilder();
+  auto align = this->buildTarget->getLlvmDataLayout()->getABITypeAlign(tgType->getLlvmType());
+
+  auto expectedInst = builder->CreateLoad(tgType->getLlvmType(), expectedRefBox->getLlvmValue());
+  expectedInst->setAlignment(align);
+
+  // The failure ordering is selected statically. A failure order that isn't a constant is treated as sequentially
+  // consistent, which is valid for any success order.
+  auto failureOrdering = llvm::AtomicOrdering::SequentiallyConsistent;
+  if (auto constOrder = llvm::dyn_cast<llvm::ConstantInt>(failureOrderBox->getLlvmValue())) {
+    auto index = constOrder->getSExtValue();
+    failureOrdering = index >= 0 && index <= CodeGen::MemoryOrder::SEQ_CST ?
+      atomicFailureOrderings[index] : llvm::AtomicOrdering::Monotonic;
+  }
+
+  auto llvmPair = this->generateAtomicOrderSwitch(
+    block, successOrderBox->getLlvmValue(), atomicRmwOrderings, [=](llvm::AtomicOrdering ordering)->llvm::Value* {
+      return block->getIrBuilder()->CreateAtomicCmpXchg(
+        destRefBox->getLlvmValue(), expectedInst, desiredValBox->getLlvmValue(), align, ordering, failureOrdering
+      );
+    }
+  );
+
+  // Write the current value back into expected and return the success flag.
+  auto storeInst = builder->CreateStore(builder->CreateExtractValue(llvmPair, 0), expectedRefBox->getLlvmValue());
+  storeInst->setAlignment(align);
+
+  result = newSrdObj<Value>(builder->CreateExtractValue(llvmPair, 1), false);
+  return true;
+}
+
+
+Bool TargetGenerator::generateAtomicFence(TiObject *context, TiObject *order)
+{
+  PREPARE_ARG(context, block, Block);
+  PREPARE_ARG(order, orderBox, Value);
+
+  this->generateAtomicOrderSwitch(
+    block, orderBox->getLlvmValue(), atomicRmwOrderings, [=](llvm::AtomicOrdering ordering)->llvm::Value* {
+      // Relaxed fences are no-ops.
+      if (ordering != llvm::AtomicOrdering::Monotonic) block->getIrBuilder()->CreateFence(ordering);
+      return 0;
+    }
+  );
+
+  return true;
+}
+
+
 //==============================================================================
 // Literal Generation Functions
 
@@ -2500,4 +2677,61 @@ std::string TargetGenerator::getAnonymouseVarName()
   return std::string("#anonymous") + std::to_string(this->anonymousVarIndex++);
 }
 
+
+
+llvm::Value* TargetGenerator::generateAtomicOrderSwitch(
+  Block *block, llvm::Value *order, llvm::AtomicOrdering const *orderings,
+  std::function<llvm::Value*(llvm::AtomicOrdering)> const &generate
+) {
+  if (auto constOrder = llvm::dyn_cast<llvm::ConstantInt>(order)) {
+    auto index = constOrder->getSExtValue();
+    return generate(
+      index >= 0 && index <= CodeGen::MemoryOrder::SEQ_CST ? orderings[index] : llvm::AtomicOrdering::Monotonic
+    );
+  }
+
+  auto llvmContext = this->buildTarget->getLlvmContext();
+  auto llvmFunc = block->getFunction()->getLlvmFunction();
+  auto builder = block->getIrBuilder();
+
+  auto mergeLlvmBlock = llvm::BasicBlock::Create(*llvmContext, this->getNewBlockName(), llvmFunc);
+  auto defaultLlvmBlock = llvm::BasicBlock::Create(*llvmContext, this->getNewBlockName(), llvmFunc);
+  auto switchInst = builder->CreateSwitch(order, defaultLlvmBlock);
+
+  std::vector<std::pair<llvm::Value*, llvm::BasicBlock*>> results;
+  auto generateCase = [&](llvm::BasicBlock *llvmBlock, llvm::AtomicOrdering ordering) {
+    builder->SetInsertPoint(llvmBlock);
+    auto llvmResult = generate(ordering);
+    results.push_back({ llvmResult, builder->GetInsertBlock() });
+    builder->CreateBr(mergeLlvmBlock);
+  };
+
+  // Relaxed, along with invalid orders, goes to the default case.
+  generateCase(defaultLlvmBlock, llvm::AtomicOrdering::Monotonic);
+  llvm::AtomicOrdering const caseOrderings[] = {
+    llvm::AtomicOrdering::Acquire, llvm::AtomicOrdering::Release, llvm::AtomicOrdering::AcquireRelease,
+    llvm::AtomicOrdering::SequentiallyConsistent
+  };
+  for (auto ordering : caseOrderings) {
+    llvm::BasicBlock *caseLlvmBlock = 0;
+    for (Int i = 0; i <= CodeGen::MemoryOrder::SEQ_CST; ++i) {
+      if (orderings[i] != ordering) continue;
+      if (caseLlvmBlock == 0) {
+        caseLlvmBlock = llvm::BasicBlock::Create(*llvmContext, this->getNewBlockName(), llvmFunc);
+      }
+      switchInst->addCase(llvm::ConstantInt::get(llvm::cast<llvm::IntegerType>(order->getType()), i), caseLlvmBlock);
+    }
+    if (caseLlvmBlock != 0) generateCase(caseLlvmBlock, ordering);
+  }
+
+  // Set insert point to the merge body.
+  builder->SetInsertPoint(mergeLlvmBlock);
+  block->setLlvmBlock(mergeLlvmBlock);
+
+  if (results.front().first == 0) return 0;
+  auto phi = builder->CreatePHI(results.front().first->getType(), results.size());
+  for (auto &r : results) phi->addIncoming(r.first, r.second);
+  return phi;
+}
+
 } // namespace
@@ -386,6 +386,31 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   /// @}
 
+  /// @name Atomic Ops Generation Functions
+  /// @{
+
+  public: Bool generateAtomicLoad(
+    TiObject *context, TiObject *type, TiObject *srcRef, TiObject *order, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicStore(
+    TiObject *context, TiObject *type, TiObject *srcVal, TiObject *destRef, TiObject *order
+  );
+
+  public: Bool generateAtomicRmw(
+    TiObject *context, TiObject *type, CodeGen::AtomicRmwOperation operation, TiObject *destRef,
+    TiObject *srcVal, TiObject *order, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicCompareExchange(
+    TiObject *context, TiObject *type, TiObject *destRef, TiObject *expectedRef, TiObject *desiredVal,
+    TiObject *successOrder, TiObject *failureOrder, TioSharedPtr &result
+  );
+
+  public: Bool generateAtomicFence(TiObject *context, TiObject *order);
+
+  /// @}
+
   /// @name Literal Generation Functions
   /// @{
 
@@ -426,6 +451,19 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   private: std::string getAnonymouseVarName();
 
+  /**
+   * @brief Generate an atomic operation for the given memory order.
+   * The orderings array maps each CodeGen::MemoryOrder to the LLVM ordering
+   * to use for this operation. If the order isn't a constant the operation is
+   * generated once per ordering and the right one is selected at runtime,
+   * with invalid orders treated as relaxed.
+   * @return The result of the operation, or 0 if the operation has no value.
+   */
+  private: llvm::Value* generateAtomicOrderSwitch(
+    Block *block, llvm::Value *order, llvm::AtomicOrdering const *orderings,
+    std::function<llvm::Value*(llvm::AtomicOrdering)> const &generate
+  );
+
   /// @}
 
 }; // class
@@ -12,6 +12,52 @@ namespace Spp::LlvmCodeGen
 using namespace llvm;
 using namespace llvm::orc;
 
+//==============================================================================
+// JitOptimizationPipeline Functions
+
+JitOptimizationPipeline::JitOptimizationPipeline(llvm::TargetMachine *targetMachine, JitOptimizationLevel l)
+  : level(l), passBuilder(targetMachine) {
+  this->passBuilder.registerModuleAnalyses(this->mam);
+  this->passBuilder.registerCGSCCAnalyses(this->cgam);
+  this->passBuilder.registerFunctionAnalyses(this->fam);
+  this->passBuilder.registerLoopAnalyses(this->lam);
+  this->passBuilder.crossRegisterProxies(this->lam, this->fam, this->cgam, this->mam);
+
+  switch (l.val) {
+    case JitOptimizationLevel::O0:
+    case JitOptimizationLevel::TIERED:
+      // In tiered mode this pipeline only serves the initial compilation. Hot functions are recompiled separately.
+      this->mpm = this->passBuilder.buildO0DefaultPipeline(llvm::OptimizationLevel::O0);
+      break;
+    case JitOptimizationLevel::O1:
+      this->mpm = this->passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O1);
+      break;
+    case JitOptimizationLevel::O2:
+      this->mpm = this->passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2);
+      break;
+    case JitOptimizationLevel::SIZE:
+      this->mpm = this->passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::Os);
+      break;
+    default:
+      this->mpm = this->passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3);
+      break;
+  }
+
+  this->mpm.addPass(llvm::VerifierPass());
+}
+
+
+void JitOptimizationPipeline::run(llvm::Module &module) {
+  this->mpm.run(module, this->mam);
+
+  // Cached results refer to the module, so they can't outlive this run.
+  this->lam.clear();
+  this->cgam.clear();
+  this->fam.clear();
+  this->mam.clear();
+}
+
+
 //==============================================================================
 // JitEngineBuilderState Functions
 
@@ -54,8 +100,38 @@ Error JitEngineBuilderState::prepareForConstruction() {
 // JitEngine Functions
 
 JitEngine::~JitEngine() {
+  if (tierUpThreads)
+    tierUpThreads->wait();
   if (compileThreads)
     compileThreads->wait();
+  if (auto err = dumpProfile())
+    logAllUnhandledErrors(std::move(err), errs(), "Failed to write profile: ");
+}
+
+
+void JitEngine::setProfiling(ProfileMode mode, Char const *filename) {
+  std::unique_ptr<ProfileManager> manager;
+  if (mode != ProfileMode::NONE)
+    manager = std::make_unique<ProfileManager>(mode, filename);
+  // Dump functions of previously instrumented modules are kept so their counters still get written.
+  std::lock_guard<std::mutex> lock(optimizationMutex);
+  profileManager = std::move(manager);
+}
+
+
+Error JitEngine::dumpProfile() {
+  std::vector<std::string> names;
+  {
+    std::lock_guard<std::mutex> lock(optimizationMutex);
+    names.swap(profileDumpFunctionNames);
+  }
+  for (auto const &name : names) {
+    auto sym = lookup(name);
+    if (!sym)
+      return sym.takeError();
+    reinterpret_cast<void(*)()>(sym->getAddress())();
+  }
+  return Error::success();
 }
 
 
@@ -78,10 +154,11 @@ Error JitEngine::addIRModule(JITDylib &jd, ThreadSafeModule tsm) {
   if (auto err = tsm.withModuleDo([&](Module &m) { return applyDataLayout(m); }))
     return err;
 
-  if (optimizeLayer.get() != nullptr) {
-    return optimizeLayer->add(jd, std::move(tsm));
+  IRLayer &layer = optimizeLayer.get() != nullptr ? static_cast<IRLayer&>(*optimizeLayer) : *compileLayer;
+  if (isTiering()) {
+    return addTieredIRModule(jd, std::move(tsm), layer);
   } else {
-    return compileLayer->add(jd, std::move(tsm));
+    return layer.add(jd, std::move(tsm));
   }
 }
 
@@ -138,13 +215,13 @@ Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> JitEngine::createCompileFu
   // Otherwise default to creating a SimpleCompiler, or ConcurrentIRCompiler,
   // depending on the number of threads requested.
   if (s.numCompileThreads > 0)
-    return std::make_unique<ConcurrentIRCompiler>(std::move(jtmb));
+    return std::make_unique<ConcurrentIRCompiler>(std::move(jtmb), s.objectCache);
 
   auto TM = jtmb.createTargetMachine();
   if (!TM)
     return TM.takeError();
 
-  return std::make_unique<TMOwningSimpleCompiler>(std::move(*TM));
+  return std::make_unique<TMOwningSimpleCompiler>(std::move(*TM), s.objectCache);
 }
 
 
@@ -158,7 +235,15 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
       objLinkingLayer(createObjectLinkingLayer(s, *es)),
       objTransformLayer(*this->es, *objLinkingLayer), 
       ctorRunner(main),
-      dtorRunner(main) {
+      dtorRunner(main),
+      objectCache(s.objectCache),
+      objectCacheSkipsOptimization(useOptimizeLayer),
+      optimizationLevel(JitOptimizationLevel::O3),
+      optimizationTimeReporting(false),
+      optimizedModuleCount(0),
+      totalOptimizationTime(0),
+      tierUpThreshold(1000),
+      tieredUpFunctionCount(0) {
 
   ErrorAsOutParameter _(&err);
 
@@ -169,6 +254,13 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
     return;
   }
 
+  // Keep a copy of the target machine builder for recompiling hot functions in tiered mode.
+  jtmb = *s.jtmb;
+
+  // Everything other than the IR that affects the generated code goes into the cache keys.
+  objectCacheContext = jtmb->getTargetTriple().str() + ";" + jtmb->getCPU() + ";" +
+    jtmb->getFeatures().getString() + ";" + ALUSUS_VERSION + ";" + LLVM_VERSION_STRING;
+
   {
     auto compileFunction = createCompileFunction(s, std::move(*s.jtmb));
     if (!compileFunction) {
@@ -198,48 +290,311 @@ std::unique_ptr<llvm::orc::IRTransformLayer>
 JitEngine::createOptimizeLayer(llvm::orc::IRLayer &prevLayer) {
   auto optimizeLayer = std::make_unique<IRTransformLayer>(*es, prevLayer);
 
+  optimizeLayer->setTransform(
+    [this](llvm::orc::ThreadSafeModule tsm,
+        const llvm::orc::MaterializationResponsibility &r) {
+      tsm.withModuleDo([this](llvm::Module &module) {
+        this->optimizeModule(module);
+      });
+
+      return tsm;
+    }
+  );
+
+  return optimizeLayer;
+}
+
+
+void JitEngine::optimizeModule(llvm::Module &module) {
   static llvm::Expected<llvm::orc::JITTargetMachineBuilder> tmb =
       llvm::orc::JITTargetMachineBuilder::detectHost();
   static std::unique_ptr<llvm::TargetMachine> targetMachine =
       std::move(tmb.get().createTargetMachine().get());
 
-  optimizeLayer->setTransform(
-    [&](llvm::orc::ThreadSafeModule tsm,
-        const llvm::orc::MaterializationResponsibility &r) {
-      tsm.withModuleDo([&](llvm::Module &module) {
-        if (llvm::verifyModule(module, &llvm::errs())) {
-          llvm::errs() << "Invalid IR before optimization\n";
-          module.print(llvm::errs(), nullptr);
-          llvm::report_fatal_error("Invalid IR generated by TargetGenerator");
-        }
+  if (llvm::verifyModule(module, &llvm::errs())) {
+    llvm::errs() << "Invalid IR before optimization\n";
+    module.print(llvm::errs(), nullptr);
+    llvm::report_fatal_error("Invalid IR generated by TargetGenerator");
+  }
 
-        llvm::LoopAnalysisManager lam;
-        llvm::FunctionAnalysisManager fam;
-        llvm::CGSCCAnalysisManager cgam;
-        llvm::ModuleAnalysisManager mam;
+  JitOptimizationLevel level(this->getOptimizationLevel());
+  Bool profiling;
+  {
+    std::lock_guard<std::mutex> lock(this->optimizationMutex);
+    profiling = this->profileManager != nullptr;
+  }
+  if (profiling && level == JitOptimizationLevel::TIERED) level = JitOptimizationLevel::O3;
+
+  // Tiered modules embed run specific addresses so they are never cached, and neither are profiled modules since
+  // instrumentation and profiles aren't part of the key.
+  if (
+    this->objectCache != nullptr && this->objectCache->isEnabled() && level != JitOptimizationLevel::TIERED &&
+    !profiling
+  ) {
+    // The key is stored as the module identifier, which is where the object cache looks for it at compile time.
+    auto key = JitObjectCache::computeKey(module, this->objectCacheContext + ";" + std::to_string(level.val));
+    module.setModuleIdentifier(key);
+    if (this->objectCacheSkipsOptimization && this->objectCache->preload(key)) {
+      if (this->optimizationTimeReporting) {
+        outStream << S("JIT optimization of module ") << key << S(" skipped, object found in cache\n");
+      }
+      return;
+    }
+  }
 
-        llvm::PassBuilder pb(targetMachine.get());
+  auto startTime = std::chrono::steady_clock::now();
+  {
+    std::lock_guard<std::mutex> lock(this->optimizationMutex);
+    if (this->profileManager != nullptr) {
+      this->profileManager->prepareModule(module, targetMachine.get(), false, this->profileDumpFunctionNames);
+    }
+    // Rebuild the pipeline only when the level changes.
+    if (this->optimizationPipeline == nullptr || this->optimizationPipeline->getLevel() != level) {
+      this->optimizationPipeline = std::make_unique<JitOptimizationPipeline>(targetMachine.get(), level);
+    }
+    this->optimizationPipeline->run(module);
+  }
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - startTime
+  ).count();
+
+  ++this->optimizedModuleCount;
+  this->totalOptimizationTime += duration;
+  PHASE_STATS->add(Core::Basic::PhaseStats::Phase::OPTIMIZATION, duration);
+  if (this->optimizationTimeReporting) {
+    outStream << S("JIT optimization of module ") << module.getName().str() << S(" took ")
+      << duration << S(" us\n");
+  }
+}
 
-        pb.registerModuleAnalyses(mam);
-        pb.registerCGSCCAnalyses(cgam);
-        pb.registerFunctionAnalyses(fam);
-        pb.registerLoopAnalyses(lam);
-        pb.crossRegisterProxies(lam, fam, cgam, mam);
 
-        llvm::ModulePassManager mpm;
-        llvm::OptimizationLevel O3 = llvm::OptimizationLevel::O3;
-        mpm = pb.buildPerModuleDefaultPipeline(O3);
+Bool JitEngine::isTiering() {
+  if (getOptimizationLevel() != JitOptimizationLevel::TIERED)
+    return false;
+  std::lock_guard<std::mutex> lock(optimizationMutex);
+  return profileManager == nullptr;
+}
 
-        mpm.addPass(llvm::VerifierPass()); // keep this too
 
-        mpm.run(module, mam);
-      });
+Error JitEngine::prepareTiering() {
+  if (tieringStubsMgr != nullptr)
+    return Error::success();
 
-      return tsm;
+  auto &tt = jtmb->getTargetTriple();
+
+  auto lctMgrOrErr = createLocalLazyCallThroughManager(tt, *es, ExecutorAddr());
+  if (!lctMgrOrErr)
+    return lctMgrOrErr.takeError();
+
+  auto ismBuilder = createLocalIndirectStubsManagerBuilder(tt);
+  if (!ismBuilder) {
+    return make_error<StringError>(
+      "Could not construct IndirectStubsManagerBuilder for target " + tt.str(), inconvertibleErrorCode()
+    );
+  }
+
+  tieringLctMgr = std::move(*lctMgrOrErr);
+  tieringStubsMgr = ismBuilder();
+  // A single background thread recompiles hot functions, which keeps the tier up state single threaded.
+  tierUpThreads = std::make_unique<ThreadPool>(hardware_concurrency(1));
+  return Error::success();
+}
+
+
+Error JitEngine::addTieredIRModule(JITDylib &jd, ThreadSafeModule tsm, IRLayer &layer) {
+  std::lock_guard<std::mutex> lock(tieringMutex);
+
+  if (auto err = prepareTiering())
+    return err;
+
+  // Recompiling a function duplicates the module's internal globals, which is only safe for constants.
+  Bool tierable = tsm.withModuleDo([](Module &m) {
+    for (auto &gv : m.globals()) {
+      if (gv.hasLocalLinkage() && !gv.isConstant()) return false;
+    }
+    return true;
+  });
+  if (!tierable)
+    return layer.add(jd, std::move(tsm));
+
+  auto tieredModule = std::make_shared<TieredModule>();
+  tieredModule->source = cloneToNewContext(tsm);
+
+  SymbolAliasMap aliases;
+  tsm.withModuleDo([&](Module &m) {
+    std::vector<llvm::Function*> funcs;
+    for (auto &func : m.functions()) {
+      if (func.isDeclaration() || func.isIntrinsic() || func.hasLocalLinkage()) continue;
+      funcs.push_back(&func);
+    }
+
+    for (auto func : funcs) {
+      auto tieredFunc = std::make_unique<TieredFunction>();
+      tieredFunc->engine = this;
+      tieredFunc->jd = &jd;
+      tieredFunc->name = func->getName().str();
+      tieredFunc->module = tieredModule;
+      tieredFunc->invocationCount = 0;
+      tieredFunc->promoted = false;
+
+      // Move the body into a tier 0 symbol and route all calls, including the ones in this module, through a stub
+      // that carries the original name. The stub is later redirected to the recompiled function.
+      func->setName(tieredFunc->name + ".tier0");
+      auto stubDecl = llvm::Function::Create(
+        func->getFunctionType(), GlobalValue::ExternalLinkage, tieredFunc->name, &m
+      );
+      stubDecl->setCallingConv(func->getCallingConv());
+      stubDecl->setAttributes(func->getAttributes());
+      func->replaceAllUsesWith(stubDecl);
+
+      instrumentTieredFunction(func, tieredFunc.get());
+
+      aliases[es->intern(mangle(tieredFunc->name))] = SymbolAliasMapEntry(
+        es->intern(mangle(func->getName())), JITSymbolFlags::Exported | JITSymbolFlags::Callable
+      );
+      tieredFunctions.push_back(std::move(tieredFunc));
     }
+  });
+
+  if (auto err = layer.add(jd, std::move(tsm)))
+    return err;
+
+  if (aliases.empty())
+    return Error::success();
+  return jd.define(lazyReexports(*tieringLctMgr, *tieringStubsMgr, jd, std::move(aliases)));
+}
+
+
+void JitEngine::instrumentTieredFunction(llvm::Function *func, TieredFunction *tieredFunc) {
+  auto &ctx = func->getContext();
+  auto ptrType = llvm::PointerType::getUnqual(ctx);
+  auto intPtrType = func->getParent()->getDataLayout().getIntPtrType(ctx);
+  auto counterType = llvm::IntegerType::get(ctx, sizeof(Word) * 8);
+  Word threshold = tierUpThreshold;
+  if (threshold == 0) threshold = 1;
+
+  // Keep the allocas in the entry block and count the invocation right after them.
+  auto &entryBlock = func->getEntryBlock();
+  auto splitPoint = entryBlock.begin();
+  while (splitPoint != entryBlock.end() && isa<AllocaInst>(&*splitPoint)) ++splitPoint;
+  auto contBlock = entryBlock.splitBasicBlock(splitPoint, "tierup.cont");
+  auto promoteBlock = BasicBlock::Create(ctx, "tierup.promote", func, contBlock);
+  entryBlock.getTerminator()->eraseFromParent();
+
+  IRBuilder<> builder(&entryBlock);
+  auto counterPtr = ConstantExpr::getIntToPtr(
+    ConstantInt::get(intPtrType, reinterpret_cast<uintptr_t>(&tieredFunc->invocationCount)), ptrType
   );
+  auto count = builder.CreateAtomicRMW(
+    AtomicRMWInst::Add, counterPtr, ConstantInt::get(counterType, 1), MaybeAlign(sizeof(Word)),
+    AtomicOrdering::Monotonic
+  );
+  auto isHot = builder.CreateICmpEQ(count, ConstantInt::get(counterType, threshold - 1));
+  builder.CreateCondBr(isHot, promoteBlock, contBlock);
 
-  return optimizeLayer;
+  builder.SetInsertPoint(promoteBlock);
+  auto hookType = llvm::FunctionType::get(builder.getVoidTy(), { ptrType }, false);
+  auto hookPtr = ConstantExpr::getIntToPtr(
+    ConstantInt::get(intPtrType, reinterpret_cast<uintptr_t>(&JitEngine::tierUpHook)), ptrType
+  );
+  auto funcPtr = ConstantExpr::getIntToPtr(
+    ConstantInt::get(intPtrType, reinterpret_cast<uintptr_t>(tieredFunc)), ptrType
+  );
+  builder.CreateCall(hookType, hookPtr, { funcPtr });
+  builder.CreateBr(contBlock);
+}
+
+
+Word JitEngine::getTieredFunctionCount() {
+  std::lock_guard<std::mutex> lock(tieringMutex);
+  return tieredFunctions.size();
+}
+
+
+void JitEngine::waitForTierUps() {
+  if (tierUpThreads)
+    tierUpThreads->wait();
+}
+
+
+void JitEngine::tierUpHook(TieredFunction *tieredFunc) {
+  if (tieredFunc->promoted.exchange(true))
+    return;
+  auto engine = tieredFunc->engine;
+  engine->tierUpThreads->async([engine, tieredFunc]() {
+    engine->tierUp(tieredFunc);
+  });
+}
+
+
+void JitEngine::tierUp(TieredFunction *tieredFunc) {
+  auto startTime = std::chrono::steady_clock::now();
+  auto const &name = tieredFunc->name;
+  auto tier1Name = name + ".tier1";
+
+  auto result = [&]() -> Error {
+    if (tierUpTargetMachine == nullptr) {
+      auto tmOrErr = jtmb->createTargetMachine();
+      if (!tmOrErr)
+        return tmOrErr.takeError();
+      tierUpTargetMachine = std::move(*tmOrErr);
+      tierUpPipeline = std::make_unique<JitOptimizationPipeline>(
+        tierUpTargetMachine.get(), JitOptimizationLevel::O3
+      );
+    }
+
+    // Clone the function alone out of the original IR. Other definitions become declarations that resolve to the
+    // existing symbols, so calls to other tiered functions keep going through their stubs.
+    auto tsm = cloneToNewContext(tieredFunc->module->source, [&name](GlobalValue const &gv) {
+      return gv.hasLocalLinkage() || gv.getName() == name;
+    });
+
+    std::unique_ptr<MemoryBuffer> obj;
+    if (auto err = tsm.withModuleDo([&](Module &m) -> Error {
+      for (auto gvName : { "llvm.global_ctors", "llvm.global_dtors" }) {
+        if (auto gv = m.getNamedGlobal(gvName)) gv->eraseFromParent();
+      }
+      auto func = m.getFunction(name);
+      if (func == nullptr)
+        return make_error<StringError>("Function not found in its module", inconvertibleErrorCode());
+      func->setName(tier1Name);
+
+      tierUpPipeline->run(m);
+
+      SimpleCompiler compiler(*tierUpTargetMachine);
+      auto objOrErr = compiler(m);
+      if (!objOrErr)
+        return objOrErr.takeError();
+      obj = std::move(*objOrErr);
+      return Error::success();
+    }))
+      return err;
+
+    if (auto err = objTransformLayer.add(*tieredFunc->jd, std::move(obj)))
+      return err;
+
+    auto sym = es->lookup(
+      makeJITDylibSearchOrder(tieredFunc->jd, JITDylibLookupFlags::MatchAllSymbols), es->intern(mangle(tier1Name))
+    );
+    if (!sym)
+      return sym.takeError();
+
+    // Swap the optimized code in. Callers pick it up on their next call through the stub.
+    return tieringStubsMgr->updatePointer(mangle(name), sym->getAddress());
+  }();
+
+  if (result) {
+    logAllUnhandledErrors(std::move(result), errs(), "JIT tier up of " + name + " failed: ");
+    return;
+  }
+
+  ++tieredUpFunctionCount;
+  if (optimizationTimeReporting) {
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - startTime
+    ).count();
+    outStream << S("JIT tier up of function ") << name << S(" took ") << duration << S(" us\n");
+  }
 }
 
 
@@ -298,6 +653,8 @@ Error LazyJitEngine::addLazyIRModule(JITDylib &jd, ThreadSafeModule tsm) {
       }))
     return err;
 
+  if (isTiering())
+    return addTieredIRModule(jd, std::move(tsm), *optimizeLayer);
   return optimizeLayer->add(jd, std::move(tsm));
 }
 
@@ -8,6 +8,8 @@
 #define SPP_LLVMCODEGEN_JITENGINES_H
 
 #include <optional>
+#include <mutex>
+#include <chrono>
 
 namespace Spp::LlvmCodeGen
 {
@@ -15,6 +17,43 @@ namespace Spp::LlvmCodeGen
 class JitEngineBuilderState;
 class LazyJitEngineBuilderState;
 
+//==============================================================================
+/// The pass pipeline used to optimize JIT modules at a specific level.
+/// The pipeline and its analysis managers are reused across modules.
+class JitOptimizationPipeline
+{
+  //============================================================================
+  // Member Variables
+
+  private: JitOptimizationLevel level;
+  private: llvm::PassBuilder passBuilder;
+  private: llvm::LoopAnalysisManager lam;
+  private: llvm::FunctionAnalysisManager fam;
+  private: llvm::CGSCCAnalysisManager cgam;
+  private: llvm::ModuleAnalysisManager mam;
+  private: llvm::ModulePassManager mpm;
+
+
+  //============================================================================
+  // Constructor
+
+  public: JitOptimizationPipeline(llvm::TargetMachine *targetMachine, JitOptimizationLevel l);
+
+
+  //============================================================================
+  // Member Functions
+
+  public: JitOptimizationLevel getLevel() const
+  {
+    return this->level;
+  }
+
+  /// Optimize the given module then drop all cached analysis results.
+  public: void run(llvm::Module &module);
+
+};
+
+
 //==============================================================================
 /// A pre-fabricated ORC JIT stack that can serve as an alternative to MCJIT.
 class JitEngine
@@ -37,6 +76,69 @@ class JitEngine
 
   protected: llvm::orc::CtorDtorRunner ctorRunner, dtorRunner;
 
+  /// A copy of the target machine builder used to create the compile function.
+  protected: std::optional<llvm::orc::JITTargetMachineBuilder> jtmb;
+
+  /// The cache of compiled objects, if any, and the compilation settings that are part of each cache key.
+  protected: JitObjectCache *objectCache;
+  protected: std::string objectCacheContext;
+
+  /// Whether optimization can be skipped for modules found in the cache. This is only possible when modules go
+  /// unchanged from the optimize layer to the compile layer.
+  protected: Bool objectCacheSkipsOptimization;
+
+  /// The optimization level to apply on modules added after this is set.
+  protected: std::atomic<Int> optimizationLevel;
+
+  /// Whether to print the time spent optimizing each module.
+  protected: std::atomic<Bool> optimizationTimeReporting;
+
+  /// Serializes access to optimizationPipeline, which can be used from compile threads.
+  protected: std::mutex optimizationMutex;
+  protected: std::unique_ptr<JitOptimizationPipeline> optimizationPipeline;
+
+  /// Instruments modules or attaches a profile to them before optimization, if profiling is enabled. Both this and
+  /// the names of the generated profile dump functions are guarded by optimizationMutex.
+  protected: std::unique_ptr<ProfileManager> profileManager;
+  protected: std::vector<std::string> profileDumpFunctionNames;
+
+  protected: std::atomic<Word> optimizedModuleCount;
+  /// Total time spent optimizing modules, in microseconds.
+  protected: std::atomic<LongWord> totalOptimizationTime;
+
+  /// The original IR of a module compiled in tiered mode, kept for recompiling its functions.
+  protected: struct TieredModule
+  {
+    llvm::orc::ThreadSafeModule source;
+  };
+
+  /// A function compiled in tiered mode. The invocation counter is incremented by the function's tier 0 code.
+  protected: struct TieredFunction
+  {
+    JitEngine *engine;
+    llvm::orc::JITDylib *jd;
+    std::string name;
+    std::shared_ptr<TieredModule> module;
+    std::atomic<Word> invocationCount;
+    std::atomic<Bool> promoted;
+  };
+
+  /// The number of invocations after which a tiered function is recompiled at O3.
+  protected: std::atomic<Word> tierUpThreshold;
+
+  /// Serializes the creation of the tiering state below.
+  protected: std::mutex tieringMutex;
+  protected: std::vector<std::unique_ptr<TieredFunction>> tieredFunctions;
+  protected: std::unique_ptr<llvm::orc::LazyCallThroughManager> tieringLctMgr;
+  protected: std::unique_ptr<llvm::orc::IndirectStubsManager> tieringStubsMgr;
+
+  /// State used only from the tier up thread.
+  protected: std::unique_ptr<llvm::TargetMachine> tierUpTargetMachine;
+  protected: std::unique_ptr<JitOptimizationPipeline> tierUpPipeline;
+  protected: std::unique_ptr<llvm::ThreadPool> tierUpThreads;
+
+  protected: std::atomic<Word> tieredUpFunctionCount;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -141,12 +243,87 @@ class JitEngine
     return objTransformLayer;
   }
 
+  /// Set the optimization level used for modules added from now on.
+  public: void setOptimizationLevel(JitOptimizationLevel level) {
+    optimizationLevel = level.val;
+  }
+
+  public: JitOptimizationLevel getOptimizationLevel() const {
+    JitOptimizationLevel level;
+    level = optimizationLevel.load();
+    return level;
+  }
+
+  /// Enable or disable printing the optimization time of each module.
+  public: void setOptimizationTimeReporting(Bool enabled) {
+    optimizationTimeReporting = enabled;
+  }
+
+  /// Returns the number of modules optimized so far.
+  public: Word getOptimizedModuleCount() const {
+    return optimizedModuleCount;
+  }
+
+  /// Returns the total time spent optimizing modules so far, in microseconds.
+  public: LongWord getTotalOptimizationTime() const {
+    return totalOptimizationTime;
+  }
+
+  /**
+   * @brief Set the profile guided optimization mode for modules added from now on.
+   *
+   * Tiered compilation is disabled while profiling is enabled and TIERED is
+   * treated as O3, since the profile already identifies the hot functions.
+   * Counters collected in GENERATE mode are written to the profile file when
+   * this engine is destroyed, or when dumpProfile is called.
+   */
+  public: void setProfiling(ProfileMode mode, Char const *filename);
+
+  /// Write the counters collected so far to the profile file then reset them.
+  public: llvm::Error dumpProfile();
+
+  /// Set the number of invocations after which a function compiled in tiered mode is recompiled at O3.
+  public: void setTierUpThreshold(Word threshold) {
+    tierUpThreshold = threshold;
+  }
+
+  public: Word getTierUpThreshold() const {
+    return tierUpThreshold;
+  }
+
+  /// Returns the number of functions recompiled at O3 so far in tiered mode.
+  public: Word getTieredUpFunctionCount() const {
+    return tieredUpFunctionCount;
+  }
+
+  /// Returns the number of functions compiled with an invocation counter in tiered mode.
+  public: Word getTieredFunctionCount();
+
+  /// Waits for the functions that already got hot to finish being recompiled.
+  public: void waitForTierUps();
+
   protected: static std::unique_ptr<llvm::orc::ObjectLayer> createObjectLinkingLayer(
     JitEngineBuilderState &s, llvm::orc::ExecutionSession &es
   );
 
   protected: std::unique_ptr<llvm::orc::IRTransformLayer> createOptimizeLayer(llvm::orc::IRLayer &prevLayer);
 
+  protected: void optimizeModule(llvm::Module &module);
+
+  protected: Bool isTiering();
+
+  protected: llvm::Error prepareTiering();
+
+  protected: llvm::Error addTieredIRModule(
+    llvm::orc::JITDylib &jd, llvm::orc::ThreadSafeModule tsm, llvm::orc::IRLayer &layer
+  );
+
+  protected: void instrumentTieredFunction(llvm::Function *func, TieredFunction *tieredFunc);
+
+  protected: static void tierUpHook(TieredFunction *tieredFunc);
+
+  protected: void tierUp(TieredFunction *tieredFunc);
+
   protected: static llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> createCompileFunction(
     JitEngineBuilderState &s, llvm::orc::JITTargetMachineBuilder jtmb
   );
@@ -223,6 +400,7 @@ class JitEngineBuilderState
   public: ObjectLinkingLayerCreator createObjectLinkingLayer;
   public: CompileFunctionCreator createCompileFunction;
   public: unsigned numCompileThreads = 0;
+  public: JitObjectCache *objectCache = nullptr;
 
   /// Called prior to JIT class construcion to fix up defaults.
   public: llvm::Error prepareForConstruction();
@@ -325,6 +503,14 @@ class JitEngineBuilderSetters
     return impl();
   }
 
+  /// Set the cache used to store and reuse compiled objects.
+  ///
+  /// If this method is not called, or is called with null, no caching is done.
+  public: SETTER_IMPL& setObjectCache(JitObjectCache *objectCache) {
+    impl().objectCache = objectCache;
+    return impl();
+  }
+
   /// Create an instance of the JIT.
   public: llvm::Expected<std::unique_ptr<JIT_TYPE>> create(CodeGen::GlobalItemRepo *itemRepo) {
     if (auto err = impl().prepareForConstruction())
@@ -26,4 +26,33 @@ void llvmDiagnosticCallback(const llvm::DiagnosticInfo &di, void *context)
   outStream << msg << "\n";
 }
 
+
+
+/**
+ * Accepts the level names used on the command line: O0, O1, O2, O3, Os, and
+ * tiered.
+ */
+Bool parseJitOptimizationLevel(Char const *str, JitOptimizationLevel &level)
+{
+  if (str == 0) return false;
+  if (compareStr(str, S("O0")) == 0) level = JitOptimizationLevel::O0;
+  else if (compareStr(str, S("O1")) == 0) level = JitOptimizationLevel::O1;
+  else if (compareStr(str, S("O2")) == 0) level = JitOptimizationLevel::O2;
+  else if (compareStr(str, S("O3")) == 0) level = JitOptimizationLevel::O3;
+  else if (compareStr(str, S("Os")) == 0) level = JitOptimizationLevel::SIZE;
+  else if (compareStr(str, S("tiered")) == 0) level = JitOptimizationLevel::TIERED;
+  else return false;
+  return true;
+}
+
+
+Bool parseProfileMode(Char const *str, ProfileMode &mode)
+{
+  if (str == 0) return false;
+  if (compareStr(str, S("generate")) == 0) mode = ProfileMode::GENERATE;
+  else if (compareStr(str, S("use")) == 0) mode = ProfileMode::USE;
+  else return false;
+  return true;
+}
+
 }
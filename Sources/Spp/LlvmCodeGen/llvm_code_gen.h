@@ -29,7 +29,27 @@ namespace Spp::LlvmCodeGen
 // Forward Declarations
 class BuildTarget;
 
+/**
+ * @brief The optimization level applied to modules compiled by the JIT.
+ *
+ * SIZE optimizes for code size (Os). TIERED compiles functions at O0 first to
+ * reduce the time to first execution, then recompiles frequently invoked
+ * functions at O3 in the background.
+ */
+s_enum(JitOptimizationLevel, O0 = 0, O1 = 1, O2 = 2, O3 = 3, SIZE = 4, TIERED = 5);
+
+/**
+ * @brief The profile guided optimization mode.
+ *
+ * GENERATE instruments generated functions with counters that are written to
+ * the profile file when the program exits, while USE optimizes the generated
+ * functions using a previously generated profile.
+ */
+s_enum(ProfileMode, NONE = 0, GENERATE = 1, USE = 2);
+
 // Global Functions
+Bool parseJitOptimizationLevel(Char const *str, JitOptimizationLevel &level);
+Bool parseProfileMode(Char const *str, ProfileMode &mode);
 void llvmDiagnosticCallback(const llvm::DiagnosticInfo &di, void *context);
 
 } // namespace
@@ -48,6 +68,8 @@ void llvmDiagnosticCallback(const llvm::DiagnosticInfo &di, void *context);
 #include "LoopContext.h"
 
 // The Generator
+#include "JitObjectCache.h"
+#include "ProfileManager.h"
 #include "jit_engines.h"
 #include "TargetGenerator.h"
 #include "BuildTarget.h"
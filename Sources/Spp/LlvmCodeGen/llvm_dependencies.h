@@ -46,6 +46,13 @@
 #include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
 #include <llvm/ExecutionEngine/Orc/ObjectLinkingLayer.h>
 #include <llvm/TargetParser/Host.h>
+#include <llvm/TargetParser/SubtargetFeature.h>
+#include <llvm/CodeGen/ParallelCG.h>
+#include <llvm/LTO/LTO.h>
+#include <llvm/Analysis/ModuleSummaryAnalysis.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Support/Caching.h>
+#include <llvm/Support/Threading.h>
 #include <llvm/ExecutionEngine/Orc/TaskDispatch.h>
 #include <llvm/Passes/StandardInstrumentations.h>
 #include <llvm/ExecutionEngine/Orc/LazyReexports.h>
@@ -57,6 +64,19 @@
 #include <llvm/Analysis/TargetLibraryInfo.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Support/raw_ostream.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/Transforms/Instrumentation/PGOInstrumentation.h>
+#include <llvm/ProfileData/InstrProf.h>
+#include <llvm/ProfileData/InstrProfReader.h>
+#include <llvm/ProfileData/InstrProfWriter.h>
+#include <llvm/Support/VirtualFileSystem.h>
 
 #define C(x)	u8##x
 #define S(x)	u8##x
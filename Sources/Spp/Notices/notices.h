@@ -306,6 +306,9 @@ DEFINE_NOTICE(CircularGlobalVarInitNotice, "Spp.Notices", "Spp", "alusus.org", "
 DEFINE_NOTICE(UnexpectedTerminalStatementNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1043", 1,
   "Unexpected terminal statement encountered."
 );
+DEFINE_NOTICE(InvalidIntrinsicNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1044", 1,
+  "Invalid intrinsic function. The intrinsic is unknown or the function's signature does not match it."
+);
 
 } // namespace
 
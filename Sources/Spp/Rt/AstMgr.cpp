@@ -44,7 +44,13 @@ void AstMgr::initBindingCaches()
     &this->dumpData,
     &this->getReferenceTypeFor,
     &this->tryGetDeepReferenceContentType,
-    &this->isInjection
+    &this->isInjection,
+    &this->getTemplateInstanceCount,
+    &this->getTemplateInstanceLookupCount,
+    &this->getTemplateInstanceHitCount,
+    &this->getCalleeLookupCount,
+    &this->getCalleeLookupHitCount,
+    &this->getCalleeLookupTime
   });
 }
 
@@ -76,6 +82,12 @@ void AstMgr::initBindings()
   this->getReferenceTypeFor = &AstMgr::_getReferenceTypeFor;
   this->tryGetDeepReferenceContentType = &AstMgr::_tryGetDeepReferenceContentType;
   this->isInjection = &AstMgr::_isInjection;
+  this->getTemplateInstanceCount = &AstMgr::_getTemplateInstanceCount;
+  this->getTemplateInstanceLookupCount = &AstMgr::_getTemplateInstanceLookupCount;
+  this->getTemplateInstanceHitCount = &AstMgr::_getTemplateInstanceHitCount;
+  this->getCalleeLookupCount = &AstMgr::_getCalleeLookupCount;
+  this->getCalleeLookupHitCount = &AstMgr::_getCalleeLookupHitCount;
+  this->getCalleeLookupTime = &AstMgr::_getCalleeLookupTime;
 }
 
 
@@ -111,6 +123,12 @@ void AstMgr::initializeRuntimePointers(CodeGen::GlobalItemRepo *globalItemRepo,
     S("Spp_AstMgr_tryGetDeepReferenceContentType"), (void*)&AstMgr::_tryGetDeepReferenceContentType
   );
   globalItemRepo->addItem(S("Spp_AstMgr_isInjection"), (void*)&AstMgr::_isInjection);
+  globalItemRepo->addItem(S("Spp_AstMgr_getTemplateInstanceCount"), (void*)&AstMgr::_getTemplateInstanceCount);
+  globalItemRepo->addItem(S("Spp_AstMgr_getTemplateInstanceLookupCount"), (void*)&AstMgr::_getTemplateInstanceLookupCount);
+  globalItemRepo->addItem(S("Spp_AstMgr_getTemplateInstanceHitCount"), (void*)&AstMgr::_getTemplateInstanceHitCount);
+  globalItemRepo->addItem(S("Spp_AstMgr_getCalleeLookupCount"), (void*)&AstMgr::_getCalleeLookupCount);
+  globalItemRepo->addItem(S("Spp_AstMgr_getCalleeLookupHitCount"), (void*)&AstMgr::_getCalleeLookupHitCount);
+  globalItemRepo->addItem(S("Spp_AstMgr_getCalleeLookupTime"), (void*)&AstMgr::_getCalleeLookupTime);
 }
 
 
@@ -403,4 +421,40 @@ Bool AstMgr::_isInjection(TiObject *self, TiObject *obj)
   return Ast::isInjection(def);
 }
 
+
+Word AstMgr::_getTemplateInstanceCount(TiObject *self)
+{
+  return Ast::Template::getTotalInstanceCount();
+}
+
+
+Word AstMgr::_getTemplateInstanceLookupCount(TiObject *self)
+{
+  return Ast::Template::getInstanceLookupCount();
+}
+
+
+Word AstMgr::_getTemplateInstanceHitCount(TiObject *self)
+{
+  return Ast::Template::getInstanceLookupHitCount();
+}
+
+
+Word AstMgr::_getCalleeLookupCount(TiObject *self)
+{
+  return Ast::CalleeTracer::getLookupCount();
+}
+
+
+Word AstMgr::_getCalleeLookupHitCount(TiObject *self)
+{
+  return Ast::CalleeTracer::getLookupHitCount();
+}
+
+
+LongWord AstMgr::_getCalleeLookupTime(TiObject *self)
+{
+  return Ast::CalleeTracer::getLookupTime();
+}
+
 } // namespace
@@ -205,6 +205,24 @@ class AstMgr : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: METHOD_BINDING_CACHE(isInjection, Bool, (TiObject*));
   private: static Bool _isInjection(TiObject *self, TiObject *obj);
 
+  public: METHOD_BINDING_CACHE(getTemplateInstanceCount, Word);
+  private: static Word _getTemplateInstanceCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getTemplateInstanceLookupCount, Word);
+  private: static Word _getTemplateInstanceLookupCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getTemplateInstanceHitCount, Word);
+  private: static Word _getTemplateInstanceHitCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getCalleeLookupCount, Word);
+  private: static Word _getCalleeLookupCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getCalleeLookupHitCount, Word);
+  private: static Word _getCalleeLookupHitCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getCalleeLookupTime, LongWord);
+  private: static LongWord _getCalleeLookupTime(TiObject *self);
+
   /// @}
 
 }; // class
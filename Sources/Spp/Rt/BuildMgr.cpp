@@ -22,7 +22,19 @@ void BuildMgr::initBindingCaches()
   Basic::initBindingCaches(this, {
     &this->dumpLlvmIrForElement,
     &this->buildObjectFileForElement,
-    &this->raiseBuildNotice
+    &this->buildObjectFileForElementWithOptions,
+    &this->buildThinLtoObjectFilesForElement,
+    &this->raiseBuildNotice,
+    &this->setJitOptimizationLevel,
+    &this->getJitOptimizationLevel,
+    &this->setJitProfiling,
+    &this->getJitOptimizedModuleCount,
+    &this->getJitOptimizationTime,
+    &this->getJitTieredFunctionCount,
+    &this->getJitTieredUpFunctionCount,
+    &this->setJitCacheDirectory,
+    &this->getJitCacheHitCount,
+    &this->getJitCacheMissCount
   });
 }
 
@@ -31,7 +43,19 @@ void BuildMgr::initBindings()
 {
   this->dumpLlvmIrForElement = &BuildMgr::_dumpLlvmIrForElement;
   this->buildObjectFileForElement = &BuildMgr::_buildObjectFileForElement;
+  this->buildObjectFileForElementWithOptions = &BuildMgr::_buildObjectFileForElementWithOptions;
+  this->buildThinLtoObjectFilesForElement = &BuildMgr::_buildThinLtoObjectFilesForElement;
   this->raiseBuildNotice = &BuildMgr::_raiseBuildNotice;
+  this->setJitOptimizationLevel = &BuildMgr::_setJitOptimizationLevel;
+  this->getJitOptimizationLevel = &BuildMgr::_getJitOptimizationLevel;
+  this->setJitProfiling = &BuildMgr::_setJitProfiling;
+  this->getJitOptimizedModuleCount = &BuildMgr::_getJitOptimizedModuleCount;
+  this->getJitOptimizationTime = &BuildMgr::_getJitOptimizationTime;
+  this->getJitTieredFunctionCount = &BuildMgr::_getJitTieredFunctionCount;
+  this->getJitTieredUpFunctionCount = &BuildMgr::_getJitTieredUpFunctionCount;
+  this->setJitCacheDirectory = &BuildMgr::_setJitCacheDirectory;
+  this->getJitCacheHitCount = &BuildMgr::_getJitCacheHitCount;
+  this->getJitCacheMissCount = &BuildMgr::_getJitCacheMissCount;
 }
 
 
@@ -40,7 +64,29 @@ void BuildMgr::initializeRuntimePointers(CodeGen::GlobalItemRepo *globalItemRepo
   globalItemRepo->addItem(S("!Spp.buildMgr"), sizeof(void*), &buildMgr);
   globalItemRepo->addItem(S("Spp_BuildMgr_dumpLlvmIrForElement"), (void*)&BuildMgr::_dumpLlvmIrForElement);
   globalItemRepo->addItem(S("Spp_BuildMgr_buildObjectFileForElement"), (void*)&BuildMgr::_buildObjectFileForElement);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_buildObjectFileForElementWithOptions"), (void*)&BuildMgr::_buildObjectFileForElementWithOptions
+  );
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_buildThinLtoObjectFilesForElement"), (void*)&BuildMgr::_buildThinLtoObjectFilesForElement
+  );
   globalItemRepo->addItem(S("Spp_BuildMgr_raiseBuildNotice"), (void*)&BuildMgr::_raiseBuildNotice);
+  globalItemRepo->addItem(S("Spp_BuildMgr_setJitOptimizationLevel"), (void*)&BuildMgr::_setJitOptimizationLevel);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getJitOptimizationLevel"), (void*)&BuildMgr::_getJitOptimizationLevel);
+  globalItemRepo->addItem(S("Spp_BuildMgr_setJitProfiling"), (void*)&BuildMgr::_setJitProfiling);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_getJitOptimizedModuleCount"), (void*)&BuildMgr::_getJitOptimizedModuleCount
+  );
+  globalItemRepo->addItem(S("Spp_BuildMgr_getJitOptimizationTime"), (void*)&BuildMgr::_getJitOptimizationTime);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_getJitTieredFunctionCount"), (void*)&BuildMgr::_getJitTieredFunctionCount
+  );
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_getJitTieredUpFunctionCount"), (void*)&BuildMgr::_getJitTieredUpFunctionCount
+  );
+  globalItemRepo->addItem(S("Spp_BuildMgr_setJitCacheDirectory"), (void*)&BuildMgr::_setJitCacheDirectory);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getJitCacheHitCount"), (void*)&BuildMgr::_getJitCacheHitCount);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getJitCacheMissCount"), (void*)&BuildMgr::_getJitCacheMissCount);
 }
 
 
@@ -58,7 +104,68 @@ Bool BuildMgr::_buildObjectFileForElement(
   TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
 ) {
   PREPARE_SELF(buildMgr, BuildMgr);
-  return buildMgr->buildManager->buildObjectFileForElement(element, objectFilename, targetTriple);
+  return buildMgr->buildManager->buildObjectFileForElement(element, objectFilename, targetTriple, 0);
+}
+
+
+Bool BuildMgr::_buildObjectFileForElementWithOptions(
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  Int optimizationLevel, Char const *cpu, Char const *features, Bool bitcode, Int partitionCount,
+  Int profileMode, Char const *profileFilename
+) {
+  if (
+    optimizationLevel < LlvmCodeGen::JitOptimizationLevel::O0 ||
+    optimizationLevel > LlvmCodeGen::JitOptimizationLevel::SIZE
+  ) {
+    throw EXCEPTION(
+      InvalidArgumentException, S("optimizationLevel"), S("Invalid optimization level."), optimizationLevel
+    );
+  }
+  if (partitionCount < 1) {
+    throw EXCEPTION(InvalidArgumentException, S("partitionCount"), S("Must be at least 1."), partitionCount);
+  }
+  if (profileMode < LlvmCodeGen::ProfileMode::NONE || profileMode > LlvmCodeGen::ProfileMode::USE) {
+    throw EXCEPTION(InvalidArgumentException, S("profileMode"), S("Invalid profile mode."), profileMode);
+  }
+  PREPARE_SELF(buildMgr, BuildMgr);
+  LlvmCodeGen::OfflineBuildTarget::ObjectFileOptions options;
+  options.optimizationLevel = optimizationLevel;
+  options.cpu = cpu;
+  options.features = features;
+  options.bitcode = bitcode;
+  options.partitionCount = partitionCount;
+  options.profileMode = profileMode;
+  options.profileFilename = profileFilename;
+  return buildMgr->buildManager->buildObjectFileForElement(element, objectFilename, targetTriple, &options);
+}
+
+
+Bool BuildMgr::_buildThinLtoObjectFilesForElement(
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  Int optimizationLevel, Char const *cpu, Char const *features, Array<String> const &ltoInputs,
+  Int profileMode, Char const *profileFilename
+) {
+  if (
+    optimizationLevel < LlvmCodeGen::JitOptimizationLevel::O0 ||
+    optimizationLevel > LlvmCodeGen::JitOptimizationLevel::SIZE
+  ) {
+    throw EXCEPTION(
+      InvalidArgumentException, S("optimizationLevel"), S("Invalid optimization level."), optimizationLevel
+    );
+  }
+  if (profileMode < LlvmCodeGen::ProfileMode::NONE || profileMode > LlvmCodeGen::ProfileMode::USE) {
+    throw EXCEPTION(InvalidArgumentException, S("profileMode"), S("Invalid profile mode."), profileMode);
+  }
+  PREPARE_SELF(buildMgr, BuildMgr);
+  LlvmCodeGen::OfflineBuildTarget::ObjectFileOptions options;
+  options.optimizationLevel = optimizationLevel;
+  options.cpu = cpu;
+  options.features = features;
+  options.lto = true;
+  options.ltoInputs = &ltoInputs;
+  options.profileMode = profileMode;
+  options.profileFilename = profileFilename;
+  return buildMgr->buildManager->buildObjectFileForElement(element, objectFilename, targetTriple, &options);
 }
 
 
@@ -72,4 +179,96 @@ void BuildMgr::_raiseBuildNotice(
   buildMgr->rootManager->flushNotices();
 }
 
+
+void BuildMgr::_setJitOptimizationLevel(TiObject *self, Int level)
+{
+  if (level < LlvmCodeGen::JitOptimizationLevel::O0 || level > LlvmCodeGen::JitOptimizationLevel::TIERED) {
+    throw EXCEPTION(InvalidArgumentException, S("level"), S("Invalid JIT optimization level."), level);
+  }
+  PREPARE_SELF(buildMgr, BuildMgr);
+  LlvmCodeGen::JitOptimizationLevel jitOptimizationLevel;
+  jitOptimizationLevel = level;
+  buildMgr->buildManager->setJitOptimizationLevel(jitOptimizationLevel);
+}
+
+
+Int BuildMgr::_getJitOptimizationLevel(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->getJitOptimizationLevel().val;
+}
+
+
+void BuildMgr::_setJitProfiling(TiObject *self, Int mode, Char const *filename)
+{
+  if (mode < LlvmCodeGen::ProfileMode::NONE || mode > LlvmCodeGen::ProfileMode::USE) {
+    throw EXCEPTION(InvalidArgumentException, S("mode"), S("Invalid profile mode."), mode);
+  }
+  PREPARE_SELF(buildMgr, BuildMgr);
+  LlvmCodeGen::ProfileMode profileMode;
+  profileMode = mode;
+  buildMgr->buildManager->setJitProfiling(profileMode, filename);
+}
+
+
+Word BuildMgr::_getJitOptimizedModuleCount(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  Word moduleCount;
+  LongWord totalTime;
+  buildMgr->buildManager->getJitOptimizationStats(moduleCount, totalTime);
+  return moduleCount;
+}
+
+
+LongWord BuildMgr::_getJitOptimizationTime(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  Word moduleCount;
+  LongWord totalTime;
+  buildMgr->buildManager->getJitOptimizationStats(moduleCount, totalTime);
+  return totalTime;
+}
+
+
+Word BuildMgr::_getJitTieredFunctionCount(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  Word tieredFunctionCount;
+  Word tieredUpFunctionCount;
+  buildMgr->buildManager->getJitTieringStats(tieredFunctionCount, tieredUpFunctionCount);
+  return tieredFunctionCount;
+}
+
+
+Word BuildMgr::_getJitTieredUpFunctionCount(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  Word tieredFunctionCount;
+  Word tieredUpFunctionCount;
+  buildMgr->buildManager->getJitTieringStats(tieredFunctionCount, tieredUpFunctionCount);
+  return tieredUpFunctionCount;
+}
+
+
+void BuildMgr::_setJitCacheDirectory(TiObject *self, Char const *dir)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  buildMgr->buildManager->setJitCacheDirectory(dir);
+}
+
+
+Word BuildMgr::_getJitCacheHitCount(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->getJitObjectCache()->getHitCount();
+}
+
+
+Word BuildMgr::_getJitCacheMissCount(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->getJitObjectCache()->getMissCount();
+}
+
 } // namespace
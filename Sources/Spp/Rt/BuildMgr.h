@@ -96,6 +96,24 @@ class BuildMgr : public TiObject, public DynamicBinding, public DynamicInterfaci
     TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
   );
 
+  public: METHOD_BINDING_CACHE(buildObjectFileForElementWithOptions,
+    Bool, (TiObject*, Char const*, Char const*, Int, Char const*, Char const*, Bool, Int, Int, Char const*)
+  );
+  public: static Bool _buildObjectFileForElementWithOptions(
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    Int optimizationLevel, Char const *cpu, Char const *features, Bool bitcode, Int partitionCount,
+    Int profileMode, Char const *profileFilename
+  );
+
+  public: METHOD_BINDING_CACHE(buildThinLtoObjectFilesForElement,
+    Bool, (TiObject*, Char const*, Char const*, Int, Char const*, Char const*, Array<String> const&, Int, Char const*)
+  );
+  public: static Bool _buildThinLtoObjectFilesForElement(
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    Int optimizationLevel, Char const *cpu, Char const *features, Array<String> const &ltoInputs,
+    Int profileMode, Char const *profileFilename
+  );
+
   public: METHOD_BINDING_CACHE(raiseBuildNotice, void, (
     Char const* /* code */, Int /* severity */, TiObject* /* astNode */
   ));
@@ -103,6 +121,36 @@ class BuildMgr : public TiObject, public DynamicBinding, public DynamicInterfaci
     TiObject *self, Char const *code, Int severity, TiObject *astNode
   );
 
+  public: METHOD_BINDING_CACHE(setJitOptimizationLevel, void, (Int /* level */));
+  public: static void _setJitOptimizationLevel(TiObject *self, Int level);
+
+  public: METHOD_BINDING_CACHE(getJitOptimizationLevel, Int);
+  public: static Int _getJitOptimizationLevel(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(setJitProfiling, void, (Int /* mode */, Char const* /* filename */));
+  public: static void _setJitProfiling(TiObject *self, Int mode, Char const *filename);
+
+  public: METHOD_BINDING_CACHE(getJitOptimizedModuleCount, Word);
+  public: static Word _getJitOptimizedModuleCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getJitOptimizationTime, LongWord);
+  public: static LongWord _getJitOptimizationTime(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getJitTieredFunctionCount, Word);
+  public: static Word _getJitTieredFunctionCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getJitTieredUpFunctionCount, Word);
+  public: static Word _getJitTieredUpFunctionCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(setJitCacheDirectory, void, (Char const* /* dir */));
+  public: static void _setJitCacheDirectory(TiObject *self, Char const *dir);
+
+  public: METHOD_BINDING_CACHE(getJitCacheHitCount, Word);
+  public: static Word _getJitCacheHitCount(TiObject *self);
+
+  public: METHOD_BINDING_CACHE(getJitCacheMissCount, Word);
+  public: static Word _getJitCacheMissCount(TiObject *self);
+
   /// @}
 
 }; // class
@@ -48,6 +48,7 @@ void GrammarMgr::_addCustomCommand(
   TiObject *self, Char const *qualifier, TiObject *ast, ParsingHandlerFunc func
 ) {
   PREPARE_SELF(grammarMgr, GrammarMgr);
+  grammarMgr->rootManager->notifyGrammarCustomized();
   grammarMgr->grammarFactory->createCustomCommand(qualifier, ast, func, grammarMgr->rootManager->getNoticeStore());
   grammarMgr->rootManager->flushNotices();
 }
@@ -57,6 +58,7 @@ Bool GrammarMgr::_addCustomGrammar(
   TiObject *self, Char const *qualifier, Char const *baseQualifier, TiObject *ast
 ) {
   PREPARE_SELF(grammarMgr, GrammarMgr);
+  grammarMgr->rootManager->notifyGrammarCustomized();
   auto result = grammarMgr->grammarFactory->createCustomGrammar(
     qualifier, baseQualifier, ast, grammarMgr->rootManager->getNoticeStore()
   );
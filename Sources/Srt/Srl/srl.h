@@ -20,6 +20,10 @@
 #include <exception>
 #include <sstream>
 #include <cassert>
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 32))
+#include <sys/single_threaded.h>
+#define SRL_HAS_SINGLE_THREADED_FLAG
+#endif
 
 namespace Srl
 {
@@ -29,12 +29,18 @@
 using Core::Notices::Notice;
 using Core::Data::Ast::List;
 using Core::Main::RootManager;
+using Core::Main::AstCache;
 
 namespace Tests
 {
 
 Str resultFilename;
 
+/// The directory of the AST cache used by the tests, or empty if the tests run without one.
+Str astCacheDirectory;
+Word astCacheHitCount = 0;
+Word astCacheStoreCount = 0;
+
 Bool isDirectory(Char const *path)
 {
   struct stat path_stat;
@@ -71,6 +77,8 @@ Bool runSourceFile(Str const &fileName)
   {
     // Prepare the root object;
     RootManager root;
+    if (getenv(S("ALUSUS_TEST_LEXER_DFA")) != 0) root.setLexerDfaEnabled(true);
+    if (astCacheDirectory.getLength() > 0) root.setAstCacheDirectory(astCacheDirectory);
     Slot<void, SharedPtr<Core::Notices::Notice> const&> noticeSlot(
       [](SharedPtr<Core::Notices::Notice> const &notice)->void
       {
@@ -81,6 +89,8 @@ Bool runSourceFile(Str const &fileName)
 
     // Parse the provided filename.
     auto ptr = root.processFile(fileName);
+    astCacheHitCount += root.getAstCache()->getHitCount();
+    astCacheStoreCount += root.getAstCache()->getStoreCount();
 
     // Restore stdout.
     fflush(stdout);
@@ -273,6 +283,70 @@ Bool runEndToEndTests(Str const &dirPath, Char const *ext = ".alusus")
   }
 }
 
+/**
+ * Checks that AST cache entries are not used after the source file or the
+ * signature changes, and that nothing is cached once the grammar is
+ * customized.
+ *
+ * @return Returns @c true if all checks succeed, otherwise @c false.
+ */
+Bool runAstCacheInvalidationTests(Str const &dirPath)
+{
+  std::cout << ">>> Testing AST cache invalidation: ";
+  Str filePath = dirPath + "invalidation_test.alusus";
+  auto writeSource = [&filePath](Char const *content) {
+    std::ofstream file(filePath.getBuf());
+    file << content;
+  };
+  auto processSource = [&dirPath, &filePath](Bool customizeGrammar, Word &hitCount, Word &storeCount)->Bool {
+    RootManager root;
+    root.setAstCacheDirectory(dirPath);
+    if (customizeGrammar) root.notifyGrammarCustomized();
+    if (root.processFile(filePath) == 0) return false;
+    hitCount = root.getAstCache()->getHitCount();
+    storeCount = root.getAstCache()->getStoreCount();
+    return true;
+  };
+
+  Char const *error = 0;
+  Word hitCount, storeCount;
+  writeSource(S("def a: 1;\n"));
+  if (!processSource(false, hitCount, storeCount) || hitCount != 0 || storeCount != 1) {
+    error = S("A new file was not stored.");
+  } else if (!processSource(false, hitCount, storeCount) || hitCount != 1 || storeCount != 0) {
+    error = S("An unchanged file was not loaded.");
+  } else {
+    writeSource(S("def a: 2;\n"));
+    if (!processSource(false, hitCount, storeCount) || hitCount != 0 || storeCount != 1) {
+      error = S("A file was loaded after its content changed.");
+    } else if (!processSource(true, hitCount, storeCount) || hitCount != 0 || storeCount != 0) {
+      error = S("The cache was used after the grammar was customized.");
+    }
+  }
+
+  // The signature describes the process, so it's checked against the cache directly.
+  if (error == 0) {
+    AstCache cache;
+    cache.setDirectory(dirPath);
+    AstCache::Recorder recorder;
+    std::vector<AstCache::Step> steps;
+    cache.store(filePath, S("a"), 1, S("signature 1"), recorder);
+    if (!cache.load(filePath, S("a"), 1, S("signature 1"), steps)) {
+      error = S("An entry was not loaded with the signature it was stored with.");
+    } else if (cache.load(filePath, S("a"), 1, S("signature 2"), steps)) {
+      error = S("An entry was loaded after the signature changed.");
+    }
+  }
+
+  std::remove(filePath);
+  if (error != 0) {
+    std::cout << "Failed." << std::endl << error << std::endl;
+    return false;
+  }
+  std::cout << "Successful." << std::endl;
+  return true;
+}
+
 } // namespace
 
 
@@ -314,7 +388,32 @@ int main(int argc, char **argv)
   resultFilename += "AlususEndToEndTest.txt";
 
   auto ret = EXIT_SUCCESS;
-  if (!runEndToEndTests(subpath.c_str(), ext)) ret = EXIT_FAILURE;
+  if (getenv(S("ALUSUS_TEST_AST_CACHE")) != 0) {
+    // Run the tests once to fill an empty AST cache, then again to replay the cached ASTs. Both runs should give the
+    // same results, and the second run should find everything the first one stored.
+    astCacheDirectory = tempPath;
+    if (astCacheDirectory(astCacheDirectory.getLength() - 1) != '/') astCacheDirectory += "/";
+    astCacheDirectory += "AlususEndToEndAstCache/";
+    std::filesystem::remove_all(astCacheDirectory.getBuf());
+    std::filesystem::create_directories(astCacheDirectory.getBuf());
+
+    if (!runAstCacheInvalidationTests(astCacheDirectory)) ret = EXIT_FAILURE;
+
+    std::cout << ">>> Filling the AST cache." << std::endl;
+    if (!runEndToEndTests(subpath.c_str(), ext)) ret = EXIT_FAILURE;
+    Word storeCount = astCacheStoreCount;
+    astCacheHitCount = 0;
+    astCacheStoreCount = 0;
+    std::cout << ">>> Replaying the AST cache." << std::endl;
+    if (!runEndToEndTests(subpath.c_str(), ext)) ret = EXIT_FAILURE;
+    std::cout << ">>> AST cache: " << storeCount << " stored, " << astCacheHitCount << " loaded, "
+              << astCacheStoreCount << " stored again." << std::endl;
+    if (storeCount == 0 || astCacheHitCount == 0 || astCacheStoreCount != 0) ret = EXIT_FAILURE;
+
+    std::filesystem::remove_all(astCacheDirectory.getBuf());
+  } else {
+    if (!runEndToEndTests(subpath.c_str(), ext)) ret = EXIT_FAILURE;
+  }
 
   std::remove(resultFilename);
 